@@ -66,6 +66,8 @@ endif()
 
 find_package(Python REQUIRED COMPONENTS Interpreter Development.Module Development.Embed)
 
+find_package(Threads REQUIRED)
+
 execute_process(
     COMMAND "${Python_EXECUTABLE}" -m nanobind --cmake_dir
     OUTPUT_STRIP_TRAILING_WHITESPACE
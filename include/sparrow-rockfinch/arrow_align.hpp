@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+// Forward declarations to avoid including heavy headers
+namespace sparrow
+{
+    class array;
+}
+
+struct ArrowArray;
+struct ArrowSchema;
+
+namespace sparrow::rockfinch
+{
+    /**
+     * @brief Checks whether an ArrowArray tree has a node with a non-zero offset
+     *        or a buffer that is not 64-byte aligned.
+     *
+     * @param array The array to inspect (children and dictionary included)
+     * @return true if realign_array would copy something
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API bool needs_realignment(const ArrowArray& array) noexcept;
+
+    /**
+     * @brief Rebuilds an array with 64-byte aligned buffers and zero offsets.
+     *
+     * Only the buffers that are misaligned, or that start before the range the
+     * array refers to (non-zero offset, or sliced list children), are copied
+     * into aligned storage; the others are shared with @p source, which @p owner
+     * keeps alive. Validity and boolean bitmaps are shifted to start at bit 0 and
+     * offsets are re-based to start at 0.
+     *
+     * Supported layouts: null, boolean, fixed-width (integers, floating-point,
+     * decimals, temporal types, fixed-size binary), (large) binary and utf8,
+     * (large) lists, maps, fixed-size lists, structs and dictionary-encoded
+     * arrays of those.
+     *
+     * The calls are counted in realign_stats.
+     *
+     * @param source The ArrowArray to realign
+     * @param schema The schema of @p source
+     * @param owner Handle keeping @p source alive and unmodified
+     * @return The realigned array, or std::nullopt if @p source is already aligned
+     *         or contains an unsupported layout (it can then be used as-is)
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API std::optional<array>
+    realign_array(const ArrowArray& source, const ArrowSchema& schema, const std::shared_ptr<const void>& owner);
+
+    /**
+     * @brief Copies an array into 64-byte aligned buffers owned by the result.
+     *
+     * Same as realign_array, except that every buffer is copied, so that the
+     * result shares nothing with @p source and owns_all_buffers holds for it.
+     * The copies are not counted in realign_stats.
+     *
+     * @param source The ArrowArray to copy
+     * @param schema The schema of @p source
+     * @return The copy, or std::nullopt if @p source contains an unsupported layout
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API std::optional<array>
+    copy_array(const ArrowArray& source, const ArrowSchema& schema);
+
+    /**
+     * @brief Checks whether every buffer of an ArrowArray tree is owned by the tree itself.
+     *
+     * True for the arrays built by copy_array and for the buffers that
+     * sparrow-rockfinch allocated itself (e.g. gathered ndarrays); false as soon
+     * as a node borrows a buffer from a producer, a NumPy array or another array.
+     *
+     * @param array The array to inspect (children and dictionary included)
+     * @return true if no buffer of @p array is shared with another owner
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API bool owns_all_buffers(const ArrowArray& array) noexcept;
+
+    /**
+     * @brief Counters of realign_array, across all threads.
+     */
+    struct realign_stats
+    {
+        /// Number of arrays passed to realign_array.
+        std::uint64_t arrays_checked = 0;
+
+        /// Number of arrays for which at least one buffer was copied.
+        std::uint64_t arrays_realigned = 0;
+
+        /// Number of buffers copied into aligned storage.
+        std::uint64_t buffers_copied = 0;
+
+        /// Number of bytes copied into aligned storage.
+        std::uint64_t bytes_copied = 0;
+    };
+
+    /**
+     * @brief Returns a snapshot of the realign_array counters.
+     */
+    SPARROW_ROCKFINCH_API realign_stats get_realign_stats() noexcept;
+
+    /**
+     * @brief Resets the realign_array counters.
+     */
+    SPARROW_ROCKFINCH_API void reset_realign_stats() noexcept;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+// Forward declarations to avoid including heavy headers
+namespace sparrow
+{
+    class array;
+}
+
+struct ArrowArray;
+struct ArrowSchema;
+
+namespace sparrow::rockfinch
+{
+    /**
+     * @brief Checks whether two schemas describe the same physical layout.
+     *
+     * Formats are compared recursively (children and dictionary); names,
+     * metadata and flags are ignored.
+     *
+     * @param lhs First schema
+     * @param rhs Second schema
+     * @return true if an array of @p lhs can be exported as-is for @p rhs
+     */
+    SPARROW_ROCKFINCH_API bool has_same_layout(const ArrowSchema& lhs, const ArrowSchema& rhs) noexcept;
+
+    /**
+     * @brief Checks from the schemas alone whether cast_array supports a cast.
+     *
+     * A supported cast can still fail on the values of an array: narrowing
+     * integer casts are checked against them.
+     *
+     * @param source The schema of the arrays to cast
+     * @param requested The requested schema
+     * @return true if arrays of @p source can be cast to @p requested
+     */
+    SPARROW_ROCKFINCH_API bool can_cast(const ArrowSchema& source, const ArrowSchema& requested) noexcept;
+
+    /**
+     * @brief Casts a shared sparrow array to the layout described by a requested schema.
+     *
+     * This is the engine behind the ``requested_schema`` argument of the Arrow
+     * PyCapsule Interface. Supported casts:
+     * - between the integer and floating-point types, except floating-point to
+     *   integer; narrowing integer casts are checked against the non-null values;
+     * - between utf8 and large_utf8, and between binary and large_binary (only
+     *   the offsets are converted, the character data is shared);
+     * - struct to struct with the same number of fields, field by field.
+     *
+     * Subtrees whose layout already matches are shared with @p source without
+     * copying; the result keeps a reference on @p source. Its schema is a copy
+     * of @p requested (names and metadata included).
+     *
+     * @param source The array to cast
+     * @param requested The requested schema
+     * @return The cast array, or std::nullopt if the cast is not supported or
+     *         would lose integer values
+     */
+    SPARROW_ROCKFINCH_API std::optional<array>
+    cast_array(const std::shared_ptr<const array>& source, const ArrowSchema& requested);
+
+    /**
+     * @brief Casts an ArrowArray kept alive by a shared owner to a requested schema.
+     *
+     * Same as the overload above for an ArrowArray that is not (yet) wrapped in a
+     * sparrow array; the result keeps a reference on @p owner.
+     *
+     * @param source The ArrowArray to cast
+     * @param source_schema The schema of @p source
+     * @param owner Handle keeping @p source alive and unmodified
+     * @param requested The requested schema
+     * @return The cast array, or std::nullopt if the cast is not supported or
+     *         would lose integer values
+     */
+    SPARROW_ROCKFINCH_API std::optional<array> cast_array(
+        const ArrowArray& source,
+        const ArrowSchema& source_schema,
+        const std::shared_ptr<const void>& owner,
+        const ArrowSchema& requested
+    );
+
+    /**
+     * @brief Casts an ArrowArray kept alive by a shared owner into another ArrowArray.
+     *
+     * Same as cast_array without building a sparrow array nor copying
+     * @p requested: the caller already holds the schema of the result.
+     *
+     * @param source The ArrowArray to cast
+     * @param source_schema The schema of @p source
+     * @param owner Handle keeping @p source alive and unmodified
+     * @param requested The requested schema
+     * @param target Filled with the cast array, which keeps a reference on @p owner;
+     *        left released on failure
+     * @return false if the cast is not supported or would lose integer values
+     */
+    SPARROW_ROCKFINCH_API bool cast_arrow_array(
+        const ArrowArray& source,
+        const ArrowSchema& source_schema,
+        const std::shared_ptr<const void>& owner,
+        const ArrowSchema& requested,
+        ArrowArray& target
+    );
+}
@@ -0,0 +1,58 @@
+/**
+ * @file arrow_device_interface.hpp
+ * @brief Structures of the Arrow C Device Data Interface.
+ *
+ * Definitions copied from the Arrow specification
+ * (https://arrow.apache.org/docs/format/CDeviceDataInterface.html), guarded so
+ * that they can coexist with another copy of them (e.g. nanoarrow or Arrow C++).
+ * sparrow-rockfinch only produces and accepts CPU data (``ARROW_DEVICE_CPU``).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <sparrow/c_interface.hpp>
+
+extern "C"
+{
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+    typedef int32_t ArrowDeviceType;
+
+    // CPU device, same as using ArrowArray directly instead of with ArrowDeviceArray
+#define ARROW_DEVICE_CPU 1
+
+    struct ArrowDeviceArray
+    {
+        struct ArrowArray array;
+        int64_t device_id;
+        ArrowDeviceType device_type;
+        void* sync_event;
+        int64_t reserved[3];
+    };
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
+#ifndef ARROW_C_DEVICE_STREAM_INTERFACE
+#define ARROW_C_DEVICE_STREAM_INTERFACE
+
+    struct ArrowDeviceArrayStream
+    {
+        ArrowDeviceType device_type;
+        int (*get_schema)(struct ArrowDeviceArrayStream* self, struct ArrowSchema* out);
+        int (*get_next)(struct ArrowDeviceArrayStream* self, struct ArrowDeviceArray* out);
+        const char* (*get_last_error)(struct ArrowDeviceArrayStream* self);
+        void (*release)(struct ArrowDeviceArrayStream* self);
+        void* private_data;
+    };
+
+#endif  // ARROW_C_DEVICE_STREAM_INTERFACE
+}
+
+namespace sparrow::rockfinch
+{
+    /// Device id reported for CPU data, which has a single device.
+    inline constexpr int64_t arrow_cpu_device_id = -1;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+// Forward declarations to avoid including heavy headers
+struct ArrowArray;
+struct ArrowSchema;
+
+namespace sparrow::rockfinch
+{
+    /**
+     * @brief How much an imported Arrow C structure is checked before use.
+     */
+    enum class validation_mode
+    {
+        /// The producer is trusted: nothing is checked (default, no overhead).
+        trusted,
+        /// The structures are checked with validate_arrow_array before any access.
+        full
+    };
+
+    /**
+     * @brief Checks that an ArrowArray is consistent with its schema and safe to read.
+     *
+     * The checks are recursive (children and dictionary) and cover:
+     * - the number of buffers and children expected for the format;
+     * - non-negative lengths and offsets, and null counts within the length;
+     * - null counts against the validity bitmaps;
+     * - monotonic, in-range offsets of (large) strings, binaries, lists and maps,
+     *   and the ranges of list views;
+     * - child lengths of structs and fixed-size lists;
+     * - UTF-8 validity of string values;
+     * - dictionary indices against the dictionary length.
+     *
+     * Buffer sizes are not part of the C Data Interface, so the data buffers
+     * cannot be checked against the ranges the array refers to. Binary and
+     * string views, unions and run-end encoded arrays only get the structural
+     * checks.
+     *
+     * @param array The array to check
+     * @param schema The schema of @p array
+     * @return A description of the first problem found, or std::nullopt if the
+     *         array is valid
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API std::optional<std::string>
+    validate_arrow_array(const ArrowArray& array, const ArrowSchema& schema);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file bitmap_kernels.hpp
+ * @brief Internal word-at-a-time kernels over Arrow bitmaps (validity and boolean data).
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ *
+ * Bits are numbered LSB first, as in the Arrow columnar format.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    /**
+     * @brief Test bit *i* of *bitmap*.
+     */
+    [[nodiscard]] inline bool bit_is_set(const std::uint8_t* bitmap, std::size_t i) noexcept
+    {
+        return ((bitmap[i / 8] >> (i % 8)) & 1u) != 0;
+    }
+
+    /**
+     * @brief Count the set bits of *bitmap* in ``[begin, end)``.
+     *
+     * Processes whole 64-bit words with a population count.
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API std::size_t
+    count_set_bits(const std::uint8_t* bitmap, std::size_t begin, std::size_t end) noexcept;
+
+    /**
+     * @brief Copy *length* bits of *source* starting at bit *source_offset* to the
+     *        start of *target*.
+     *
+     * *target* must hold at least ``(length + 7) / 8`` bytes; the unused bits of
+     * its last byte are cleared. Works a byte at a time when *source_offset* is
+     * not a multiple of 8, and with ``memcpy`` otherwise.
+     */
+    SPARROW_ROCKFINCH_API void
+    copy_bits(const std::uint8_t* source, std::size_t source_offset, std::uint8_t* target, std::size_t length) noexcept;
+
+    /**
+     * @brief Unpack *length* bits of *bitmap* starting at bit *offset* into one
+     *        ``bool`` per bit.
+     *
+     * With *invert*, ``out[i]`` is true when the bit is cleared, which turns a
+     * validity bitmap into a null mask.
+     *
+     * Whole bitmap bytes go through an AVX2 kernel when the CPU supports it
+     * (detected once at run time), an SSE2 kernel on other x86 targets and a
+     * multiply-based portable kernel elsewhere.
+     */
+    SPARROW_ROCKFINCH_API void
+    unpack_bits(const std::uint8_t* bitmap, std::size_t offset, std::size_t length, bool* out, bool invert) noexcept;
+
+    /**
+     * @brief Pack *length* one-byte booleans into the start of *out*, one bit each.
+     *
+     * Any non-zero byte counts as true, as for NumPy ``bool_`` data. With
+     * *invert*, a bit is set for false values, which turns a null mask into a
+     * validity bitmap. *out* must hold at least ``(length + 7) / 8`` bytes; the
+     * unused bits of its last byte are cleared.
+     *
+     * Dispatched like unpack_bits(): AVX2 and SSE2 compare-and-movemask kernels
+     * on x86, a multiply-based portable kernel elsewhere.
+     *
+     * @return The number of set bits written.
+     */
+    SPARROW_ROCKFINCH_API std::size_t
+    pack_bits(const std::uint8_t* values, std::size_t length, std::uint8_t* out, bool invert) noexcept;
+
+    /**
+     * @brief Set one bit per value of *values* that differs from *sentinel*.
+     *
+     * Turns the ``NaT`` of NumPy ``datetime64``/``timedelta64`` data (the
+     * minimum ``int64``) into an Arrow validity bitmap. *out* must hold at
+     * least ``(length + 7) / 8`` bytes; the unused bits of its last byte are
+     * cleared.
+     *
+     * Uses an AVX2 compare-and-movemask kernel when the CPU supports it
+     * (detected once at run time) and a portable kernel elsewhere.
+     *
+     * @return The number of set bits written.
+     */
+    SPARROW_ROCKFINCH_API std::size_t
+    pack_not_equal(const std::int64_t* values, std::size_t length, std::int64_t sentinel, std::uint8_t* out) noexcept;
+
+    /**
+     * @brief Set ``values[i]`` to *fill* for each cleared bit ``offset + i`` of
+     *        *bitmap*, ``i < length``.
+     *
+     * Reads the bitmap a 64-bit word at a time (a byte at a time on big-endian
+     * targets) and skips the words without cleared bits, so that the cost is
+     * close to a scan of the bitmap when nulls are sparse. Used to write NaN
+     * sentinels over the nulls of floating-point exports.
+     */
+    template <typename T>
+    void fill_unset_bits(const std::uint8_t* bitmap, std::size_t offset, std::size_t length, T* values, const T& fill) noexcept
+    {
+        constexpr std::size_t word_bits = std::endian::native == std::endian::little ? 64 : 8;
+        std::size_t i = 0;
+        // Head, up to a byte boundary of the bitmap
+        for (; i < length && (offset + i) % 8 != 0; ++i)
+        {
+            if (!bit_is_set(bitmap, offset + i))
+            {
+                values[i] = fill;
+            }
+        }
+        const std::uint8_t* bytes = bitmap + (offset + i) / 8;
+        for (; length - i >= word_bits; i += word_bits, bytes += word_bits / 8)
+        {
+            std::uint64_t cleared = 0;
+            if constexpr (word_bits == 64)
+            {
+                std::memcpy(&cleared, bytes, sizeof(cleared));
+                cleared = ~cleared;
+            }
+            else
+            {
+                cleared = static_cast<std::uint8_t>(~*bytes);
+            }
+            while (cleared != 0)
+            {
+                values[i + static_cast<std::size_t>(std::countr_zero(cleared))] = fill;
+                cleared &= cleared - 1;
+            }
+        }
+        for (; i < length; ++i)
+        {
+            if (!bit_is_set(bitmap, offset + i))
+            {
+                values[i] = fill;
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file lazy_arrow_array.hpp
+ * @brief Internal holder of imported Arrow C structures materialized on demand.
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    /**
+     * @brief Owner of an imported ``ArrowArray`` / ``ArrowSchema`` pair that builds
+     *        the typed ``sparrow::array`` only when it is first needed.
+     *
+     * Until ``materialize`` is called, the structures are kept exactly as the
+     * producer sent them: querying the length or the schema, or re-exporting the
+     * buffers, does not build any sparrow layout object.  Once materialized, the
+     * structures are owned by the ``sparrow::array`` and the raw accessors return
+     * its structures, so that both views always describe the same buffers.
+     *
+     * Like the SparrowArray using it, this class is not synchronized.
+     */
+    class SPARROW_ROCKFINCH_API lazy_arrow_array
+    {
+    public:
+        /**
+         * @brief Take ownership of *array* and *schema*.
+         *
+         * The release callbacks of the arguments are reset, as when moving
+         * Arrow C structures.
+         */
+        lazy_arrow_array(ArrowArray&& array, ArrowSchema&& schema) noexcept;
+
+        lazy_arrow_array(const lazy_arrow_array&) = delete;
+        lazy_arrow_array& operator=(const lazy_arrow_array&) = delete;
+        lazy_arrow_array(lazy_arrow_array&&) = delete;
+        lazy_arrow_array& operator=(lazy_arrow_array&&) = delete;
+
+        ~lazy_arrow_array();
+
+        /// The imported ``ArrowArray`` (the materialized array's once materialized).
+        [[nodiscard]] const ArrowArray& arrow_array() const;
+
+        /// The imported ``ArrowSchema`` (the materialized array's once materialized).
+        [[nodiscard]] const ArrowSchema& arrow_schema() const;
+
+        /// Whether the typed ``sparrow::array`` has been built.
+        [[nodiscard]] bool is_materialized() const noexcept;
+
+        /**
+         * @brief Build the typed ``sparrow::array`` on first call and return it.
+         */
+        [[nodiscard]] sparrow::array& materialize();
+
+    private:
+        ArrowArray m_array{};
+        ArrowSchema m_schema{};
+        std::optional<sparrow::array> m_materialized;
+    };
+}
@@ -0,0 +1,101 @@
+/**
+ * @file shared_arrow_array.hpp
+ * @brief Internal helpers to export ``ArrowArray`` views that share buffer ownership.
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+struct ArrowArray;
+
+namespace sparrow::rockfinch::detail
+{
+    /// Alignment (and padding granularity) of the buffers allocated by sparrow-rockfinch.
+    inline constexpr std::size_t arrow_buffer_alignment = 64;
+
+    /**
+     * @brief Deleter matching the allocation performed by ``make_aligned_buffer``.
+     */
+    struct aligned_buffer_deleter
+    {
+        SPARROW_ROCKFINCH_API void operator()(std::byte* ptr) const noexcept;
+    };
+
+    /// Owning pointer to a buffer allocated by ``make_aligned_buffer``.
+    using aligned_buffer = std::unique_ptr<std::byte[], aligned_buffer_deleter>;
+
+    /**
+     * @brief Allocate a zero-initialized buffer of at least *size* bytes.
+     *
+     * The buffer is aligned on ``arrow_buffer_alignment`` bytes and its size is
+     * rounded up to a multiple of it, as recommended by the Arrow columnar format.
+     *
+     * @param size  Minimum number of bytes.
+     * @return      The new buffer.
+     */
+    [[nodiscard]] SPARROW_ROCKFINCH_API aligned_buffer make_aligned_buffer(std::size_t size);
+
+    /**
+     * @brief Private data attached to an ``ArrowArray`` that references buffers
+     *        owned by another object.
+     *
+     * Every node of an exported tree (root, children and dictionary) carries its
+     * own instance so that a consumer may move a child out of its parent and
+     * release it independently, as allowed by the Arrow C Data Interface.
+     */
+    struct shared_arrow_array_private_data
+    {
+        /// Reference-counted handle keeping the source buffers alive.
+        std::shared_ptr<const void> owner;
+
+        /// Buffers owned by this node (e.g. produced by a cast), released with it.
+        std::vector<aligned_buffer> storage;
+
+        /// Buffer pointers exposed through ``ArrowArray::buffers``.
+        std::vector<const void*> buffers;
+
+        /// Child nodes exposed through ``ArrowArray::children`` (owned).
+        std::vector<ArrowArray*> children;
+
+        /// Dictionary node exposed through ``ArrowArray::dictionary`` (owned).
+        ArrowArray* dictionary = nullptr;
+    };
+
+    /**
+     * @brief Arrow release callback for an ``ArrowArray`` whose private data is a
+     *        ``shared_arrow_array_private_data`` (e.g. built by ``make_shared_arrow_array``).
+     *
+     * Releases the children and the dictionary that have not been moved out,
+     * drops the reference on the owner and nulls out all ``ArrowArray`` fields.
+     *
+     * @param array  The ``ArrowArray`` to release.
+     */
+    SPARROW_ROCKFINCH_API void release_shared_arrow_array(ArrowArray* array);
+
+    /**
+     * @brief Fill *target* with a view of *source* that shares its buffers.
+     *
+     * No buffer is copied: the resulting ``ArrowArray`` tree points to the
+     * buffers of *source* and holds a reference on *owner*, which must keep
+     * those buffers alive and unmodified.  Only the small per-node structures
+     * (buffer pointer tables, children) are allocated.
+     *
+     * @param source  The ``ArrowArray`` whose buffers are shared.
+     * @param owner   Handle keeping *source* alive.
+     * @param target  Uninitialized ``ArrowArray`` to fill.
+     */
+    SPARROW_ROCKFINCH_API void make_shared_arrow_array(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        ArrowArray& target
+    );
+}
@@ -0,0 +1,80 @@
+/**
+ * @file shared_arrow_schema.hpp
+ * @brief Internal immutable, reference-counted ``ArrowSchema`` tree for repeated exports.
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+struct ArrowSchema;
+
+namespace sparrow::rockfinch::detail
+{
+    /**
+     * @brief Immutable deep copy of an ``ArrowSchema`` shared by all its exports.
+     *
+     * The schema tree (format strings, names, metadata and children) is copied
+     * once by ``make``.  Each call to ``export_to`` then fills an ``ArrowSchema``
+     * whose strings point into this tree and whose private data holds a
+     * reference on it, so that exporting a flat schema allocates nothing.
+     * Nested schemas only allocate the per-export child nodes, never strings.
+     *
+     * The reference count is intrusive so that it can be carried by the
+     * exported ``ArrowSchema`` structures without extra allocations; the
+     * ``std::shared_ptr`` returned by ``make`` holds one of these references.
+     */
+    class SPARROW_ROCKFINCH_API shared_arrow_schema
+    {
+    public:
+        /**
+         * @brief Build a shared schema from a deep copy of *source*.
+         *
+         * @param source  The schema to copy.
+         * @return        A handle on the new shared schema.
+         */
+        [[nodiscard]] static std::shared_ptr<const shared_arrow_schema> make(const ArrowSchema& source);
+
+        shared_arrow_schema(const shared_arrow_schema&) = delete;
+        shared_arrow_schema& operator=(const shared_arrow_schema&) = delete;
+        shared_arrow_schema(shared_arrow_schema&&) = delete;
+        shared_arrow_schema& operator=(shared_arrow_schema&&) = delete;
+
+        /**
+         * @brief Fill *target* with an export of the shared schema.
+         *
+         * The release callback of *target* (and of its children) drops the
+         * reference taken on this object.
+         *
+         * @param target  Uninitialized ``ArrowSchema`` to fill.
+         */
+        void export_to(ArrowSchema& target) const;
+
+        /**
+         * @brief Return the cached schema tree.
+         */
+        [[nodiscard]] const ArrowSchema& schema() const noexcept;
+
+    private:
+        shared_arrow_schema();
+        ~shared_arrow_schema();
+
+        void export_node(const ArrowSchema& node, ArrowSchema& target) const;
+        void retain() const noexcept;
+        void release_reference() const noexcept;
+
+        static void release_flat_node(ArrowSchema* schema);
+        static void release_nested_node(ArrowSchema* schema);
+
+        std::unique_ptr<ArrowSchema> m_schema;
+        mutable std::atomic<std::size_t> m_ref_count{1};
+    };
+}
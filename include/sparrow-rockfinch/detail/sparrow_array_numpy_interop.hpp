@@ -15,22 +15,39 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
 
+#include <sparrow-rockfinch/detail/shared_arrow_array.hpp>
 #include <sparrow-rockfinch/sparrow_array_python_class.hpp>
 
 #include <sparrow/arrow_interface/arrow_schema.hpp>
-#include <sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp>
 #include <sparrow/types/data_type.hpp>
 
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+
+namespace nanobind::detail
+{
+    /// Lets ``nb::ndarray`` hold Arrow half floats as NumPy ``float16``.
+    template <>
+    struct dtype_traits<sparrow::float16_t>
+    {
+        static constexpr dlpack::dtype value{static_cast<std::uint8_t>(dlpack::dtype_code::Float), 16, 1};
+        static constexpr auto name = const_name("float16");
+    };
+}
+
 namespace sparrow::rockfinch::detail
 {
     namespace nb = nanobind;
@@ -76,6 +93,9 @@ namespace sparrow::rockfinch::detail
         bool m_valid = false;
     };
 
+    /// The ``NaT`` (not a time) of NumPy ``datetime64`` and ``timedelta64`` data.
+    inline constexpr std::int64_t numpy_nat = std::numeric_limits<std::int64_t>::min();
+
     /**
      * @brief Private data attached to an ``ArrowArray`` that borrows memory
      *        from a NumPy array.
@@ -93,6 +113,9 @@ namespace sparrow::rockfinch::detail
 
         /// Whether the NumPy buffer was writable when borrowed.
         bool writable = false;
+
+        /// Validity bitmap built at import (e.g. from ``NaT``), if any.
+        aligned_buffer validity;
     };
 
     /**
@@ -102,6 +125,13 @@ namespace sparrow::rockfinch::detail
     {
         /// Number of elements in the (1-D) array.
         std::size_t size;
+
+        /// Distance in bytes between consecutive elements (negative or zero for
+        /// reversed or broadcast views).
+        std::ptrdiff_t stride;
+
+        /// Whether the elements are adjacent, in which case they can be borrowed.
+        bool contiguous;
     };
 
     /**
@@ -130,72 +160,173 @@ namespace sparrow::rockfinch::detail
     }
 
     /**
-     * @brief Build a ``SparrowArray`` that borrows memory from a typed NumPy buffer.
+     * @brief Build a ``SparrowArray`` that borrows its value buffer from a Python object.
+     *
+     * Constructs an ``ArrowArray`` whose second buffer (the value buffer) points
+     * directly into *data* and whose release callback is
+     * ``release_numpy_arrow_array``, which drops the reference to *owner*.
+     * Unlike ``sparrow_array_from_numpy_buffer``, *owner* is not recorded as
+     * the NumPy owner of the result, so it can be any object (e.g. a capsule
+     * holding a DLPack tensor).
+     *
+     * @param data        Pointer to the raw values buffer.
+     * @param size        Number of elements.
+     * @param format      The Arrow format string of the values.
+     * @param owner       The Python object that keeps *data* alive.
+     * @param writable    Whether the buffer was writable at borrow time.
+     * @param validity    Validity bitmap, owned by the returned array (none if null).
+     * @param null_count  Number of cleared bits of *validity*.
+     * @return            A ``SparrowArray`` wrapping the borrowed data.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_borrowed_buffer(
+        const void* data,
+        std::size_t size,
+        std::string_view format,
+        const nb::object& owner,
+        bool writable,
+        aligned_buffer validity = nullptr,
+        std::size_t null_count = 0
+    );
+
+    /**
+     * @brief Build a ``SparrowArray`` that borrows its value buffer from NumPy.
      *
      * Constructs an ``ArrowArray`` whose second buffer (the value buffer) points
      * directly into *data*.  The returned ``SparrowArray`` keeps *owner* alive
      * so the NumPy array is not garbage-collected while the Arrow array still
-     * references its memory.
+     * references its memory, and records it as its NumPy owner (see
+     * ``SparrowArray::set_numpy_owner``).
+     *
+     * @param data        Pointer to the raw values buffer.
+     * @param size        Number of elements.
+     * @param format      The Arrow format string of the values.
+     * @param owner       The Python ndarray object that owns *data*.
+     * @param writable    Whether the buffer was writable at borrow time.
+     * @param validity    Validity bitmap, owned by the returned array (none if null).
+     * @param null_count  Number of cleared bits of *validity*.
+     * @return            A ``SparrowArray`` wrapping the borrowed data.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_numpy_buffer(
+        const void* data,
+        std::size_t size,
+        std::string_view format,
+        const nb::object& owner,
+        bool writable,
+        aligned_buffer validity = nullptr,
+        std::size_t null_count = 0
+    );
+
+    /**
+     * @brief Pack NumPy ``bool_`` values into a new aligned Arrow bitmap.
+     *
+     * Uses the vectorized ``pack_bits`` kernel and writes straight into the
+     * bitmap, without an intermediate ``std::vector<bool>``.
      *
-     * @tparam T         The C++ type corresponding to the ndarray's dtype.
-     * @param data       Pointer to the raw values buffer.
-     * @param size       Number of elements.
-     * @param owner      The Python ndarray object that owns *data*.
-     * @param writable   Whether the buffer was writable at borrow time.
-     * @return           A ``SparrowArray`` wrapping the borrowed data.
+     * @param data    Pointer to *size* contiguous ``bool_`` bytes.
+     * @param size    Number of elements.
+     * @param invert  Set the bits of false values (turns a null mask into a
+     *                validity bitmap).
+     * @return        The bitmap and its number of set bits.
      */
-    template <typename T>
-    [[nodiscard]] SparrowArray
-    sparrow_array_from_typed_ndarray(const void* data, std::size_t size, const nb::object& owner, bool writable)
-    {
-        auto buffers = std::make_unique<const void*[]>(2);
-        buffers[0] = nullptr;        // validity bitmap – none
-        buffers[1] = data;           // value buffer
-
-        Py_INCREF(owner.ptr());
-        auto private_data = std::make_unique<numpy_arrow_array_private_data>();
-        private_data->owner = owner.ptr();
-        private_data->buffers = buffers.get();
-        private_data->writable = writable;
-
-        ArrowArray arrow_array{};
-        arrow_array.length = static_cast<int64_t>(size);
-        arrow_array.null_count = 0;
-        arrow_array.offset = 0;
-        arrow_array.n_buffers = 2;
-        arrow_array.n_children = 0;
-        arrow_array.buffers = buffers.get();
-        arrow_array.children = nullptr;
-        arrow_array.dictionary = nullptr;
-        arrow_array.private_data = private_data.get();
-        arrow_array.release = &release_numpy_arrow_array;
-
-        try
-        {
-            ArrowSchema arrow_schema = sparrow::
-                make_arrow_schema<std::string_view, std::string_view, std::vector<sparrow::metadata_pair>>(
-                    arrow_format_for<T>(),
-                    std::string_view{},
-                    std::nullopt,
-                    std::nullopt,
-                    nullptr,
-                    std::array<bool, 0>{},
-                    nullptr,
-                    false
-                );
+    [[nodiscard]] std::pair<aligned_buffer, std::size_t>
+    pack_numpy_bools(const void* data, std::size_t size, bool invert);
 
-            SparrowArray result(sparrow::array(std::move(arrow_array), std::move(arrow_schema)));
-            result.set_numpy_owner(owner.ptr(), writable);
-            buffers.release();
-            private_data.release();
-            return result;
-        }
-        catch (...)
-        {
-            Py_DECREF(owner.ptr());
-            throw;
-        }
-    }
+    /**
+     * @brief Copy the elements of a strided buffer into a new aligned buffer.
+     *
+     * Any stride is accepted, including negative and zero ones; see
+     * ``gather_strided``. Elements in non-native byte order are swapped on the
+     * way with ``gather_strided_byteswap``. The GIL is released while large
+     * inputs are gathered.
+     *
+     * @param buffer  The ``Py_buffer`` to read.
+     * @param info    The result of ``validate_numpy_input`` for *buffer*.
+     * @return        A buffer holding ``info.size`` contiguous elements.
+     */
+    [[nodiscard]] aligned_buffer gather_numpy_buffer(const Py_buffer& buffer, const ndarray_input_info& info);
+
+    /**
+     * @brief Build a primitive ``SparrowArray`` that owns its buffers.
+     *
+     * @param values      The value buffer (values, or a bitmap for format ``"b"``).
+     * @param size        Number of elements.
+     * @param format      The Arrow format string.
+     * @param validity    Validity bitmap (none if null).
+     * @param null_count  Number of cleared bits of *validity*.
+     * @return            A ``SparrowArray`` owning *values* and *validity*.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_aligned_buffer(
+        aligned_buffer values,
+        std::size_t size,
+        std::string_view format,
+        aligned_buffer validity = nullptr,
+        std::size_t null_count = 0
+    );
+
+    /**
+     * @brief Build a boolean ``SparrowArray`` from NumPy ``bool_`` values.
+     *
+     * The values are packed into a bitmap owned by the returned array, which
+     * does not reference the NumPy buffer. Strided buffers are gathered first.
+     *
+     * @param buffer      A ``Py_buffer`` of ``bool_`` elements.
+     * @param info        The result of ``validate_numpy_input`` for *buffer*.
+     * @param validity    Validity bitmap (none if null).
+     * @param null_count  Number of cleared bits of *validity*.
+     * @return            A ``SparrowArray`` of Arrow format ``"b"``.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_bool_ndarray(
+        const Py_buffer& buffer,
+        const ndarray_input_info& info,
+        aligned_buffer validity = nullptr,
+        std::size_t null_count = 0
+    );
+
+    /**
+     * @brief Build the validity bitmap of a NumPy ndarray from a null mask.
+     *
+     * *mask* is converted with ``numpy.asarray(mask, dtype=bool)`` and packed
+     * with ``pack_numpy_bools`` (inverted, so that a set bit marks a valid
+     * value); strided masks are gathered first.
+     *
+     * @param array_obj  The 1-D ndarray the mask applies to.
+     * @param mask       A boolean array-like of the same shape, true for nulls.
+     * @return           The bitmap and the number of nulls; the bitmap is null
+     *                   when the mask has no true value.
+     *
+     * @throws nb::value_error  If the ndarray is not 1-D or the shapes differ.
+     */
+    [[nodiscard]] std::pair<aligned_buffer, std::size_t>
+    validity_from_numpy_mask(const nb::object& array_obj, const nb::object& mask);
+
+    /**
+     * @brief Import a NumPy ``datetime64`` or ``timedelta64`` ndarray.
+     *
+     * NumPy does not describe these dtypes through the buffer protocol, so the
+     * data is read through an ``int64`` view of the same memory. Units ``s``,
+     * ``ms``, ``us`` and ``ns`` map to Arrow timestamps (without time zone) and
+     * durations, shared without copy when contiguous; ``datetime64[D]`` maps to
+     * ``date32`` after a narrowing copy. ``NaT`` values become nulls: the
+     * validity bitmap is built with ``pack_not_equal``, combined with
+     * *validity* if any, and omitted when there is no null. 2-D arrays are
+     * imported as fixed-size lists.
+     *
+     * @param array_obj   A ``numpy.ndarray`` instance.
+     * @param align       Copy borrowed data that is not 64-byte aligned.
+     * @param validity    Validity bitmap from a mask (none if null).
+     * @param null_count  Number of cleared bits of *validity*.
+     * @return            A ``SparrowArray`` containing the ndarray data.
+     *
+     * @throws nb::type_error   If the dtype or its unit is not supported.
+     * @throws nb::value_error  If the array is neither 1-D nor 2-D, or a
+     *                          ``datetime64[D]`` value does not fit ``date32``.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_temporal_ndarray(
+        const nb::object& array_obj,
+        bool align,
+        aligned_buffer validity = nullptr,
+        std::size_t null_count = 0
+    );
 
     /**
      * @brief Compare two Python objects for equality (``==``).
@@ -221,97 +352,116 @@ namespace sparrow::rockfinch::detail
     /**
      * @brief Validate that a ``Py_buffer`` is suitable for SparrowArray import.
      *
-     * Checks that the buffer is 1-D, and for arrays with more than one element
-     * requires contiguous strides.
+     * Checks that the buffer is 1-D. Any stride is accepted; arrays with at
+     * most one element are always contiguous.
      *
      * @param buffer  The ``Py_buffer`` to inspect.
-     * @return        An ``ndarray_input_info`` with the validated element count.
+     * @return        An ``ndarray_input_info`` with the element count and layout.
      *
-     * @throws nb::value_error  If the buffer is not 1-D or not contiguous.
+     * @throws nb::value_error  If the buffer is not 1-D.
      */
     [[nodiscard]] ndarray_input_info validate_numpy_input(const Py_buffer& buffer);
 
     /**
-     * @brief Check whether a NumPy ``dtype`` matches a given dtype-spec string.
+     * @brief Element types that ``from_ndarray`` imports.
+     */
+    enum class numpy_buffer_type : std::uint8_t
+    {
+        unsupported,
+        boolean,
+        int8,
+        uint8,
+        int16,
+        uint16,
+        int32,
+        uint32,
+        int64,
+        uint64,
+        float16,
+        float32,
+        float64
+    };
+
+    /**
+     * @brief Resolve the element type of a buffer from its format and item size.
      *
-     * @param dtype  A ``numpy.dtype`` instance.
-     * @param spec   A NumPy dtype-spec string (e.g. ``"float64"``).
-     * @return       ``true`` if the dtypes are equal.
+     * Uses static lookup tables indexed by the struct-module format character
+     * and the item size, so that no ``numpy.dtype`` object is built or compared.
+     * Platform-dependent codes (e.g. ``'l'``, 4 or 8 bytes) resolve through the
+     * item size. The byte order prefix is skipped, see
+     * ``numpy_buffer_is_byte_swapped``.
+     *
+     * @param buffer  A ``Py_buffer`` acquired with ``PyBUF_FORMAT``.
+     * @return        The element type, or ``numpy_buffer_type::unsupported``.
      */
-    [[nodiscard]] bool numpy_dtype_equals(const nb::object& dtype, const char* spec);
+    [[nodiscard]] numpy_buffer_type numpy_buffer_type_of(const Py_buffer& buffer) noexcept;
 
     /**
-     * @brief Return the NumPy dtype-spec string for a C++ numeric type.
+     * @brief Whether the elements of a buffer are stored in non-native byte order.
      *
-     * @tparam T  A primitive numeric type.
-     * @return    The dtype string (e.g. ``"float64"`` for ``double``).
+     * True for multi-byte elements whose format starts with a foreign byte
+     * order prefix (e.g. ``'>i'`` on little-endian targets, as for NumPy
+     * ``'>i4'`` data read from big-endian files).
      *
-     * Produces a compile-time error if ``T`` is not a supported type.
+     * @param buffer  A ``Py_buffer`` acquired with ``PyBUF_FORMAT``.
      */
-    template <typename T>
-    [[nodiscard]] constexpr const char* numpy_dtype_spec() noexcept
-    {
-        if constexpr (std::same_as<T, std::int8_t>)
-        {
-            return "int8";
-        }
-        else if constexpr (std::same_as<T, std::uint8_t>)
-        {
-            return "uint8";
-        }
-        else if constexpr (std::same_as<T, std::int16_t>)
-        {
-            return "int16";
-        }
-        else if constexpr (std::same_as<T, std::uint16_t>)
-        {
-            return "uint16";
-        }
-        else if constexpr (std::same_as<T, std::int32_t>)
-        {
-            return "int32";
-        }
-        else if constexpr (std::same_as<T, std::uint32_t>)
-        {
-            return "uint32";
-        }
-        else if constexpr (std::same_as<T, std::int64_t>)
-        {
-            return "int64";
-        }
-        else if constexpr (std::same_as<T, std::uint64_t>)
-        {
-            return "uint64";
-        }
-        else if constexpr (std::same_as<T, float>)
-        {
-            return "float32";
-        }
-        else if constexpr (std::same_as<T, double>)
-        {
-            return "float64";
-        }
-        else
-        {
-            static_assert(!sizeof(T*), "Unsupported NumPy dtype");
-        }
-    }
+    [[nodiscard]] bool numpy_buffer_is_byte_swapped(const Py_buffer& buffer) noexcept;
 
     /**
      * @brief Import a 1-D contiguous NumPy ndarray into a ``SparrowArray``.
      *
-     * Supported dtypes are bool, int8/16/32/64, uint8/16/32/64, float32, and
-     * float64.  For bool arrays the data is copied (Sparrow stores bools
-     * bit-packed); for numeric types the returned ``SparrowArray`` borrows the
-     * ndarray's memory buffer.
+     * Supported dtypes are bool, int8/16/32/64, uint8/16/32/64, float16,
+     * float32, and float64.  2-D arrays are imported as fixed-size lists, see
+     * ``sparrow_array_from_matrix``.  For bool arrays the data is copied (Sparrow stores bools
+     * bit-packed); for contiguous numeric arrays the returned ``SparrowArray``
+     * borrows the ndarray's memory buffer, and strided ones are gathered into
+     * an aligned buffer, as are byte-swapped ones (e.g. ``'>f8'``), which are
+     * converted to native byte order.  The dtype is resolved from the buffer format
+     * with ``numpy_buffer_type_of``.  ``datetime64`` and ``timedelta64``
+     * arrays, which have no buffer format, go through
+     * ``sparrow_array_from_temporal_ndarray``.
+     *
+     * Nulls of 1-D arrays come from the mask of a ``numpy.ma.MaskedArray``,
+     * from *mask*, or from the values equal to *null_sentinel* (NaN matches
+     * NaN); they become a validity bitmap (see ``validity_from_numpy_mask``)
+     * while the values stay shared.
+     *
+     * @param array_obj      A ``numpy.ndarray`` or ``numpy.ma.MaskedArray`` instance.
+     * @param align          Copy numeric data that is not 64-byte aligned.
+     * @param mask           ``None`` or a boolean array-like, true for nulls.
+     * @param null_sentinel  ``None`` or the value that marks nulls.
+     * @return               A ``SparrowArray`` containing the ndarray data.
+     *
+     * @throws nb::value_error  If the array is neither 1-D nor 2-D, if more than
+     *                          one source of nulls is given, or if nulls are
+     *                          given for a 2-D array.
+     * @throws nb::type_error   If the dtype is not supported.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_ndarray(
+        const nb::object& array_obj,
+        bool align,
+        const nb::object& mask = nb::none(),
+        const nb::object& null_sentinel = nb::none()
+    );
+
+    /**
+     * @brief Import a 2-D NumPy ndarray as a fixed-size list array.
+     *
+     * An ``(N, K)`` array becomes ``N`` lists of ``K`` values: the flattened
+     * ndarray is imported with ``sparrow_array_from_ndarray`` and is the child
+     * of a ``fixed_size_list<T>[K]`` array, so C-contiguous numeric arrays are
+     * shared (zero-copy). Other layouts are made C-contiguous first.
      *
-     * @param array_obj  A ``numpy.ndarray`` instance.
-     * @return           A ``SparrowArray`` containing the ndarray data.
+     * @param array_obj  A 2-D ``numpy.ndarray`` instance.
+     * @param buffer     The ``Py_buffer`` acquired from *array_obj*.
+     * @param align      Copy numeric data that is not 64-byte aligned.
+     * @return           A ``SparrowArray`` of Arrow format ``"+w:K"``.
      *
-     * @throws nb::value_error  If the array is not 1-D or not contiguous.
+     * @throws nb::value_error  If the array has no columns.
      * @throws nb::type_error   If the dtype is not supported.
      */
-    [[nodiscard]] SparrowArray sparrow_array_from_ndarray(const nb::object& array_obj);
+    [[nodiscard]] SparrowArray
+    sparrow_array_from_matrix(const nb::object& array_obj, const Py_buffer& buffer, bool align);
 
     /**
      * @brief Mark a NumPy array as read-only (``arr.setflags(write=False)``).
@@ -379,52 +529,93 @@ namespace sparrow::rockfinch::detail
     }
 
     /**
-     * @brief Create a ``memoryview`` object from a raw data pointer.
-     *
-     * The returned ``memoryview`` keeps *owner* alive so the underlying memory
-     * is not freed prematurely.
+     * @brief Return the quiet NaN of a floating-point type, including ``float16_t``.
+     */
+    template <typename T>
+    [[nodiscard]] T quiet_nan() noexcept
+    {
+        if constexpr (std::same_as<T, sparrow::float16_t>)
+        {
+            // Exponent all ones, most significant mantissa bit set
+            constexpr std::uint16_t bits = 0x7E00;
+            T result;
+            std::memcpy(&result, &bits, sizeof(bits));
+            return result;
+        }
+        else
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    /**
+     * @brief Copy the values of a nullable ``ArrowArray`` into a new NumPy
+     *        array, with a sentinel in place of the nulls.
      *
-     * @param data      Pointer to the raw bytes.
-     * @param len       Number of bytes.
-     * @param owner     Python object that owns the memory.
-     * @param readonly  If true, the view is read-only.
-     * @return          A ``memoryview`` Python object.
+     * The nulls are written with ``fill_unset_bits``. Used with NaN for
+     * floating-point arrays and ``NaT`` for temporal ones.
      *
-     * @throws nb::python_error  If buffer creation fails.
+     * @tparam S           The C++ type of the Arrow values.
+     * @tparam T           The C++ element type of the NumPy array (``S`` widened, if different).
+     * @param arrow_array  Source ``ArrowArray``, with a validity bitmap.
+     * @param size         Number of elements to copy.
+     * @param fill         The value of the nulls.
+     * @return             A 1-D ``numpy.ndarray`` owning its data.
      */
+    template <typename S, typename T = S>
     [[nodiscard]] nb::object
-    make_python_memory_view(const void* data, Py_ssize_t len, nb::handle owner, bool readonly);
+    make_numpy_copy_with_null_fill(const ArrowArray* arrow_array, std::size_t size, const T& fill)
+    {
+        return make_numpy_copy<T>(
+            size,
+            [&](T* out)
+            {
+                const auto* src = static_cast<const S*>(arrow_array->buffers[1]) + arrow_array->offset;
+                std::copy_n(src, size, out);
+                fill_unset_bits(
+                    static_cast<const std::uint8_t*>(arrow_array->buffers[0]),
+                    static_cast<std::size_t>(arrow_array->offset),
+                    size,
+                    out,
+                    fill
+                );
+            }
+        );
+    }
 
     /**
      * @brief Create a zero-copy NumPy view over the value buffer of an
      *        ``ArrowArray``.
      *
-     * Builds a ``memoryview`` over the buffer and wraps it with
-     * ``numpy.frombuffer``.
+     * The view is built directly as an ``nb::ndarray`` whose owner is
+     * *owner*, so no ``memoryview`` or ``numpy.frombuffer`` call is involved
+     * and the view keeps *owner* alive.
      *
      * @tparam T           The C++ element type.
      * @param arrow_array  Source ``ArrowArray``.
      * @param size         Number of elements.
      * @param owner        Python object that keeps the backing memory alive.
-     * @return             A 1-D ``numpy.ndarray`` (read-only view).
+     * @param writable     If true, the view is writable; the caller must own
+     *                     the buffer exclusively (see ``SparrowArray::make_buffers_exclusive``).
+     * @return             A 1-D ``numpy.ndarray`` (read-only unless *writable*).
      */
     template <typename T>
-    [[nodiscard]] nb::object
-    make_numpy_view_from_arrow_values(const ArrowArray* arrow_array, std::size_t size, nb::handle owner)
+    [[nodiscard]] nb::object make_numpy_view_from_arrow_values(
+        const ArrowArray* arrow_array,
+        std::size_t size,
+        nb::handle owner,
+        bool writable = false
+    )
     {
-        static nb::module_ numpy = nb::module_::import_("numpy");
         const auto* data = static_cast<const T*>(arrow_array->buffers[1]) + arrow_array->offset;
-        nb::object memory_view = make_python_memory_view(
-            data,
-            static_cast<Py_ssize_t>(size * sizeof(T)),
-            owner,
-            true
-        );
-        return numpy.attr("frombuffer")(
-            memory_view,
-            nb::arg("dtype") = numpy_dtype_spec<T>(),
-            nb::arg("count") = size
-        );
+        const std::array<size_t, 1> shape = {size};
+        if (writable)
+        {
+            nb::ndarray<nb::numpy, T, nb::ndim<1>, nb::c_contig> result(const_cast<T*>(data), 1, shape.data(), owner);
+            return nb::cast(result, nb::rv_policy::reference);
+        }
+        nb::ndarray<nb::numpy, const T, nb::ndim<1>, nb::c_contig> result(data, 1, shape.data(), owner);
+        return nb::cast(result, nb::rv_policy::reference);
     }
 
     /**
@@ -438,30 +629,25 @@ namespace sparrow::rockfinch::detail
      * @param size         Number of elements.
      * @param owner        Python object that keeps the backing memory alive.
      * @param copy         If true, force a copy; otherwise prefer a view.
+     * @param writable     If true, a view is writable (copies always are).
      * @return             A 1-D ``numpy.ndarray``.
      */
     template <typename T>
-    [[nodiscard]] nb::object
-    make_numpy_from_arrow_buffer(const ArrowArray* arrow_array, std::size_t size, nb::handle owner, bool copy)
+    [[nodiscard]] nb::object make_numpy_from_arrow_buffer(
+        const ArrowArray* arrow_array,
+        std::size_t size,
+        nb::handle owner,
+        bool copy,
+        bool writable = false
+    )
     {
         if (copy)
         {
             return make_numpy_copy_from_arrow_values<T>(arrow_array, size, false);
         }
-        return make_numpy_view_from_arrow_values<T>(arrow_array, size, owner);
+        return make_numpy_view_from_arrow_values<T>(arrow_array, size, owner, writable);
     }
 
-    /**
-     * @brief Wrap an Arrow validity bitmap buffer as a ``dynamic_bitset_view``.
-     *
-     * @param buffer  Raw pointer to the bitmap bytes.
-     * @param size    Number of bits (elements).
-     * @param offset  Bit offset into the bitmap.
-     * @return        A ``dynamic_bitset_view<std::uint8_t>`` over the bitmap.
-     */
-    [[nodiscard]] sparrow::dynamic_bitset_view<std::uint8_t>
-    make_arrow_bitset_view(const void* buffer, std::size_t size, std::size_t offset);
-
     /**
      * @brief Interpret the ``copy`` argument of ``__array__``.
      *
@@ -472,33 +658,172 @@ namespace sparrow::rockfinch::detail
      */
     [[nodiscard]] bool parse_copy_argument(const nb::object& copy_arg);
 
+    /**
+     * @brief How ``to_numpy`` represents the nulls of an array.
+     */
+    enum class null_export_mode
+    {
+        /// Reject nullable bool and integer arrays (nullable floats are exported as-is).
+        raise,
+        /// Return a ``numpy.ma.MaskedArray`` whose mask flags the nulls.
+        mask,
+        /// Return a copy where the nulls are replaced by a caller-chosen value.
+        sentinel
+    };
+
+    /**
+     * @brief Interpret the ``nulls`` argument of ``to_numpy``.
+     *
+     * @param nulls  ``None``, ``"mask"`` or ``"sentinel"``.
+     * @return       The corresponding mode (``raise`` for ``None``).
+     *
+     * @throws nb::value_error  If *nulls* is another value.
+     */
+    [[nodiscard]] null_export_mode parse_null_export_mode(const nb::object& nulls);
+
+    /**
+     * @brief How ``to_numpy`` exports a dictionary-encoded array.
+     */
+    enum class dictionary_export_mode
+    {
+        /// Reject dictionary-encoded arrays.
+        raise,
+        /// Export the indices, the dictionary values being exported separately.
+        codes
+    };
+
+    /**
+     * @brief Interpret the ``dictionary`` argument of ``to_numpy``.
+     *
+     * @param dictionary  ``None`` or ``"codes"``.
+     * @return            The corresponding mode (``raise`` for ``None``).
+     *
+     * @throws nb::value_error  If *dictionary* is another value.
+     */
+    [[nodiscard]] dictionary_export_mode parse_dictionary_export_mode(const nb::object& dictionary);
+
     /**
      * @brief Verify that a sparrow array can be safely exported to NumPy.
      *
-     * Nullable float arrays are allowed (nulls become NaN sentinels after a
-     * copy).  Nullable bool and integer arrays are rejected because NumPy has
-     * no universal sentinel for those types.
+     * Nullable floating-point arrays, float16 included, are allowed (nulls
+     * become NaN sentinels after a copy, see ``make_numpy_copy_with_null_fill``),
+     * as are nullable timestamps, dates and durations (nulls become ``NaT``)
+     * and nullable strings and binaries (nulls become ``None``).
+     * Nullable bool and integer arrays are rejected because NumPy has
+     * no universal sentinel for those types, unless *nulls* asks for a mask or
+     * a caller-chosen sentinel.
      *
      * @param array  The sparrow array to validate.
+     * @param nulls  How the nulls are to be exported.
+     *
+     * @throws nb::type_error  If the array is a nullable bool or integer type
+     *                         and *nulls* is ``null_export_mode::raise``.
+     */
+    void validate_numpy_export_supported(const sparrow::array& array, null_export_mode nulls);
+
+    /**
+     * @brief Build the NumPy null mask of an ``ArrowArray`` (true for nulls).
      *
-     * @throws nb::type_error  If the array is a nullable bool or integer type.
+     * The validity bitmap is unpacked with ``unpack_bits``.
+     *
+     * @param arrow_array  Source ``ArrowArray``, with a validity bitmap.
+     * @param size         Number of elements.
+     * @return             A writable 1-D ``numpy.ndarray`` of bool.
      */
-    void validate_numpy_export_supported(const sparrow::array& array);
+    [[nodiscard]] nb::object make_numpy_null_mask(const ArrowArray* arrow_array, std::size_t size);
 
     /**
      * @brief Convert a ``SparrowArray`` to a ``numpy.ndarray``.
      *
      * Primitive numeric arrays export as zero-copy views when possible.
      * Bool arrays always copy because Sparrow stores them bit-packed.
-     * Nullable float arrays export via copy using NaN sentinels.
+     * Timestamps and durations export as ``datetime64``/``timedelta64`` views
+     * of the same unit, ``date64`` as ``datetime64[ms]`` and ``date32`` as a
+     * ``datetime64[D]`` copy.  utf8 and large_utf8 arrays are copied into a
+     * ``StringDType`` array on NumPy 2 and into an object array of ``str``
+     * otherwise; binary and large_binary arrays into an object array of
+     * ``bytes``.  The nulls of string arrays are ``None``.
+     *
+     * With ``null_export_mode::mask``, the result is a ``numpy.ma.MaskedArray``
+     * whose data is the same (zero-copy) array and whose mask is unpacked from
+     * the validity bitmap.  With ``null_export_mode::sentinel``, the values are
+     * copied and the nulls are set to *fill_value*.
+     *
+     * Views are read-only and hold the buffers they cover, not *self*.  With
+     * *writable*, a view is made writable after
+     * ``SparrowArray::make_buffers_exclusive`` (copy-on-write), unless the
+     * array hands back its writable NumPy source, and holds
+     * ``SparrowArray::writable_view_owner``: while it is alive, further
+     * writable views share its buffers without copying them again.
+     *
+     * With ``dictionary_export_mode::codes``, a dictionary-encoded array
+     * exports its indices like a plain integer array (nullable ones need
+     * *nulls* to be ``mask`` or ``sentinel``); see
+     * ``sparrow_array_dictionary_to_numpy`` for the dictionary values.
+     *
+     * @param self        The ``SparrowArray`` to export.
+     * @param copy        If true, always produce a copy.
+     * @param nulls       How the nulls are exported.
+     * @param fill_value  The value of the nulls with ``null_export_mode::sentinel``.
+     * @param writable    If true, the result is writable.
+     * @param dictionary  How a dictionary-encoded array is exported.
+     * @return            A 1-D ``numpy.ndarray`` or ``numpy.ma.MaskedArray``.
+     *
+     * @throws nb::type_error   If the array type cannot be exported, or if
+     *                          *dictionary* does not match the array.
+     * @throws nb::value_error  If *fill_value* is missing in sentinel mode.
+     */
+    [[nodiscard]] nb::object sparrow_array_to_numpy(
+        SparrowArray& self,
+        bool copy,
+        null_export_mode nulls = null_export_mode::raise,
+        const nb::object& fill_value = nb::none(),
+        bool writable = false,
+        dictionary_export_mode dictionary = dictionary_export_mode::raise
+    );
+
+    /**
+     * @brief Export the dictionary values of a dictionary-encoded ``SparrowArray``.
+     *
+     * The values are exported like a plain array of their type (a read-only
+     * zero-copy view for numeric types), without decoding the indices.
      *
-     * @param self  The ``SparrowArray`` to export.
+     * @param self  The dictionary-encoded ``SparrowArray``.
      * @param copy  If true, always produce a copy.
      * @return      A 1-D ``numpy.ndarray``.
      *
-     * @throws nb::type_error  If the array type cannot be exported.
+     * @throws nb::type_error  If the array is not dictionary-encoded, or if its
+     *                         dictionary has nulls or cannot be exported.
      */
-    [[nodiscard]] nb::object sparrow_array_to_numpy(SparrowArray& self, bool copy);
+    [[nodiscard]] nb::object sparrow_array_dictionary_to_numpy(SparrowArray& self, bool copy);
+
+    /**
+     * @brief Implementation of ``SparrowArray.to_numpy``.
+     *
+     * Parses *nulls* and *dictionary* and forwards to ``sparrow_array_to_numpy``.
+     * With ``dictionary="codes"``, returns the tuple ``(codes, categories)``.
+     */
+    [[nodiscard]] nb::object sparrow_array_to_numpy_method(
+        SparrowArray& self,
+        bool copy,
+        const nb::object& nulls,
+        const nb::object& fill_value,
+        bool writable,
+        const nb::object& dictionary
+    );
+
+    /**
+     * @brief Implementation of ``SparrowArray.to_categorical``.
+     *
+     * Builds a ``pandas.Categorical`` from the codes (``-1`` for the nulls) and
+     * the categories of a dictionary-encoded array; the values are never decoded.
+     *
+     * @param self  The dictionary-encoded ``SparrowArray``.
+     * @return      A ``pandas.Categorical``, ordered if the dictionary is.
+     *
+     * @throws nb::type_error  If the array is not dictionary-encoded.
+     */
+    [[nodiscard]] nb::object sparrow_array_to_categorical(SparrowArray& self);
 
     /**
      * @brief Implementation of ``SparrowArray.__array__`` (NumPy array protocol).
@@ -518,28 +843,72 @@ namespace sparrow::rockfinch::detail
 
     /**
      * @brief Create a ``SparrowArray`` from any object implementing
-     *        ``__arrow_c_array__``.
+     *        ``__arrow_c_array__`` or ``__arrow_c_device_array__``.
+     *
+     * ``__arrow_c_array__`` is preferred when both are available.
      *
-     * @param arrow_array  An ``ArrowArrayExportable`` Python object.
+     * @param arrow_array  An ``ArrowArrayExportable`` or ``ArrowDeviceArrayExportable``
+     *                     Python object.
+     * @param lazy         Keep the imported structures and build the sparrow array
+     *                     on first typed access only.
+     * @param validate     ``"trusted"`` or ``"full"`` (see ``validation_mode``).
+     * @param align        Copy the misaligned or offset buffers into 64-byte
+     *                     aligned storage (see ``SparrowArray::realign``).
      * @return             A ``SparrowArray`` wrapping the imported data.
      *
-     * @throws nb::type_error  If the object does not implement the protocol
-     *                         or returns malformed capsules.
+     * @throws nb::type_error    If the object does not implement the protocol
+     *                           or returns malformed capsules.
+     * @throws nb::value_error   If @p validate is not a known mode.
+     * @throws nb::python_error  If the device array does not live on the CPU, or
+     *                           (ValueError) if the data fails validation.
      */
-    [[nodiscard]] SparrowArray sparrow_array_from_arrow(const nb::object& arrow_array);
+    [[nodiscard]] SparrowArray
+    sparrow_array_from_arrow(const nb::object& arrow_array, bool lazy, std::string_view validate, bool align);
+
+    /**
+     * @brief Implementation of the module-level ``import_arrays_from_capsules``.
+     *
+     * Imports a whole batch of ``(schema_capsule, array_capsule)`` pairs in one
+     * pass (see ``sparrow::rockfinch::import_arrays_from_capsules``).
+     *
+     * @param capsule_pairs  A sequence of 2-tuples of PyCapsules.
+     * @return               The imported arrays, in input order.
+     *
+     * @throws nb::type_error    If an element is not a 2-tuple.
+     * @throws nb::python_error  If a capsule is invalid or already consumed, or
+     *                           if an array cannot be built.
+     */
+    [[nodiscard]] std::vector<SparrowArray> import_arrays_from_capsules(const nb::sequence& capsule_pairs);
 
     /**
      * @brief Implementation of ``SparrowArray.__arrow_c_array__``.
      *
-     * Exports the array via the Arrow PyCapsule Interface.
+     * Exports the array via the Arrow PyCapsule Interface, cast to
+     * *requested_schema* when possible (see ``cast_array``).
      *
      * @param self              The ``SparrowArray`` instance.
-     * @param requested_schema  Ignored (best-effort conversion not implemented).
+     * @param requested_schema  ``None`` or a PyCapsule containing an ``ArrowSchema``.
      * @return                  A tuple ``(schema_capsule, array_capsule)``.
+     * @throws nb::python_error If *requested_schema* is not a valid schema capsule.
      */
     [[nodiscard]] nb::tuple
     sparrow_array_to_arrow(const SparrowArray& self, nb::object requested_schema);
 
+    /**
+     * @brief Implementation of ``SparrowArray.__arrow_c_device_array__``.
+     *
+     * Same as ``sparrow_array_to_arrow`` with an ``ArrowDeviceArray`` capsule
+     * describing CPU memory.
+     *
+     * @param self              The ``SparrowArray`` instance.
+     * @param requested_schema  ``None`` or a PyCapsule containing an ``ArrowSchema``.
+     * @param kwargs            Protocol keywords; none is supported yet.
+     * @return                  A tuple ``(schema_capsule, device_array_capsule)``.
+     * @throws nb::python_error If a keyword is set or *requested_schema* is invalid.
+     */
+    [[nodiscard]] nb::tuple
+    sparrow_array_to_device_array(const SparrowArray& self, nb::object requested_schema, const nb::kwargs& kwargs);
+
     /**
      * @brief Implementation of ``SparrowArray.__arrow_c_schema__``.
      *
@@ -552,4 +921,72 @@ namespace sparrow::rockfinch::detail
      */
     [[nodiscard]] nb::object sparrow_array_to_schema(const SparrowArray& self);
 
+    /**
+     * @brief Implementation of ``SparrowArray.__dlpack__``.
+     *
+     * Exports bool and numeric arrays without nulls as 1-D tensors, and
+     * fixed-size lists of them as C-contiguous 2-D tensors, on the CPU device.
+     * The tensor shares the buffers of the array, held like those of the NumPy
+     * views (see ``SparrowArray::owner``), except for bools, which are unpacked
+     * into a copy, and when *copy* is true. With *max_version* ``(1, 0)`` or
+     * above the capsule holds a ``DLManagedTensorVersioned``, flagged read-only
+     * unless the array borrows a writable NumPy source; otherwise a
+     * ``DLManagedTensor``, which cannot be flagged, so it holds a private copy
+     * under the same condition. The values are also copied while a writable
+     * NumPy view of the array is alive (``SparrowArray::has_writable_view``).
+     * Copies are flagged ``IS_COPIED`` in versioned capsules. The deleter
+     * takes the GIL, as consumers may call it from any thread.
+     *
+     * @param self         The ``SparrowArray`` to export.
+     * @param stream       Must be ``None``.
+     * @param max_version  ``None`` or the ``(major, minor)`` version of the consumer.
+     * @param dl_device    ``None`` or ``(kDLCPU, 0)``.
+     * @param copy         ``None`` (copy if needed), ``True`` or ``False``.
+     * @return             A ``"dltensor_versioned"`` or ``"dltensor"`` PyCapsule.
+     *
+     * @throws nb::type_error    If the array has nulls or another type.
+     * @throws nb::buffer_error  If another device is requested, or if
+     *                           *copy* is false and a copy is needed.
+     * @throws nb::value_error   If *stream* is not ``None``.
+     */
+    [[nodiscard]] nb::object sparrow_array_to_dlpack(
+        SparrowArray& self,
+        const nb::object& stream,
+        const nb::object& max_version,
+        const nb::object& dl_device,
+        const nb::object& copy
+    );
+
+    /**
+     * @brief Implementation of ``SparrowArray.__dlpack_device__``.
+     *
+     * @return  The tuple ``(kDLCPU, 0)``.
+     */
+    [[nodiscard]] nb::tuple sparrow_array_dlpack_device(const SparrowArray& self);
+
+    /**
+     * @brief Import a DLPack tensor into a ``SparrowArray``.
+     *
+     * *tensor* is a DLPack capsule or an object implementing ``__dlpack__``,
+     * asked for a versioned capsule first (``max_version=(1, 0)``). The
+     * capsule is consumed (renamed ``"used_dltensor..."``) and the managed
+     * tensor is wrapped in a capsule whose destructor calls its deleter; that
+     * capsule is the owner of the borrowed buffer, released with the array by
+     * ``release_numpy_arrow_array`` (see ``sparrow_array_from_borrowed_buffer``).
+     * Contiguous numeric tensors are shared; strided ones are gathered with
+     * ``gather_strided`` and bools are packed, after which the tensor is
+     * released. 2-D tensors become ``fixed_size_list<T>[K]`` arrays.
+     *
+     * @param tensor  A capsule or an object implementing ``__dlpack__``.
+     * @param align   Copy shared data that is not 64-byte aligned.
+     * @return        A ``SparrowArray`` containing the tensor data.
+     *
+     * @throws nb::type_error    If *tensor* is not a DLPack producer or
+     *                           capsule, or the dtype is not supported.
+     * @throws nb::buffer_error  If the tensor is not on the CPU device.
+     * @throws nb::value_error   If the tensor is neither 1-D nor 2-D, or has
+     *                           no columns.
+     */
+    [[nodiscard]] SparrowArray sparrow_array_from_dlpack(const nb::object& tensor, bool align);
+
 }  // namespace sparrow::rockfinch::detail
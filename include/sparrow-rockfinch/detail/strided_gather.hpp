@@ -0,0 +1,63 @@
+/**
+ * @file strided_gather.hpp
+ * @brief Internal kernels copying strided elements into a contiguous buffer.
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <sparrow-rockfinch/config/config.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    /// Minimum number of bytes gathered before the work is split across threads.
+    inline constexpr std::size_t parallel_gather_min_bytes = std::size_t{1} << 22;
+
+    /**
+     * @brief Copy *length* elements of *item_size* bytes, *stride* bytes apart
+     *        from *source*, to the contiguous buffer *target*.
+     *
+     * *stride* may be negative (reversed views) or zero (broadcast views);
+     * element ``i`` is read at ``source + i * stride``. The loops are
+     * specialized for 1, 2, 4 and 8 byte elements so that each copy compiles
+     * to a single load and store. From ``parallel_gather_min_bytes`` on, the
+     * elements are split in contiguous ranges across the calling thread and
+     * the workers of a pool shared by all gathers, started on first use, of
+     * up to ``std::thread::hardware_concurrency()`` threads (8 at most).
+     *
+     * @param source     Address of element 0.
+     * @param stride     Distance in bytes between consecutive elements.
+     * @param item_size  Size of an element in bytes.
+     * @param length     Number of elements.
+     * @param target     Buffer of at least ``length * item_size`` bytes.
+     */
+    SPARROW_ROCKFINCH_API void gather_strided(
+        const std::byte* source,
+        std::ptrdiff_t stride,
+        std::size_t item_size,
+        std::size_t length,
+        std::byte* target
+    ) noexcept;
+
+    /**
+     * @brief Same as gather_strided(), reversing the byte order of each element.
+     *
+     * Converts big-endian data to little-endian and back. Contiguous 2, 4 and
+     * 8 byte elements are swapped 32 bytes at a time with an AVX2 byte
+     * shuffle when the CPU supports it (detected once at run time); other
+     * elements use the compiler's byte-swap builtins. Large inputs are split
+     * across threads as in gather_strided().
+     */
+    SPARROW_ROCKFINCH_API void gather_strided_byteswap(
+        const std::byte* source,
+        std::ptrdiff_t stride,
+        std::size_t item_size,
+        std::size_t length,
+        std::byte* target
+    ) noexcept;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file struct_pool.hpp
+ * @brief Internal freelist pool for the fixed-size Arrow C interface structures.
+ *
+ * This header is **not** part of the public API. It lives in the ``detail``
+ * namespace and ``detail/`` directory to prevent accidental inclusion by
+ * downstream consumers.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <sparrow-rockfinch/config/config.hpp>
+#include <sparrow-rockfinch/pycapsule.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    /**
+     * @brief Thread-safe freelist of heap-allocated ``T`` objects.
+     *
+     * ``acquire`` reuses a previously released object when one is available
+     * (a hit) and falls back to ``new`` otherwise (a miss).  ``release`` keeps
+     * up to ``max_cached`` objects for reuse and deletes the others, so the pool
+     * never grows beyond its steady-state working set.
+     *
+     * @tparam T  A trivially copyable structure (``ArrowSchema``, ``ArrowArray``, ...).
+     */
+    template <class T>
+    class struct_pool
+    {
+    public:
+        static constexpr std::size_t max_cached = 1024;
+
+        struct_pool() = default;
+        struct_pool(const struct_pool&) = delete;
+        struct_pool& operator=(const struct_pool&) = delete;
+        struct_pool(struct_pool&&) = delete;
+        struct_pool& operator=(struct_pool&&) = delete;
+
+        ~struct_pool()
+        {
+            for (T* ptr : m_free)
+            {
+                delete ptr;
+            }
+        }
+
+        /**
+         * @brief Return a value-initialized ``T``, reusing a pooled one if possible.
+         */
+        [[nodiscard]] T* acquire()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_free.empty())
+                {
+                    T* ptr = m_free.back();
+                    m_free.pop_back();
+                    m_hits.fetch_add(1, std::memory_order_relaxed);
+                    *ptr = T{};
+                    return ptr;
+                }
+            }
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return new T{};
+        }
+
+        /**
+         * @brief Give back an object obtained from ``acquire``.
+         *
+         * The object must already have been released in the Arrow sense
+         * (its ``release`` callback called or moved out).
+         */
+        void release(T* ptr) noexcept
+        {
+            if (ptr == nullptr)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_free.size() < max_cached)
+                {
+                    try
+                    {
+                        m_free.push_back(ptr);
+                        return;
+                    }
+                    catch (...)
+                    {
+                        // Could not grow the freelist: fall back to delete
+                    }
+                }
+            }
+            delete ptr;
+        }
+
+        /**
+         * @brief Snapshot of the hit/miss counters and of the freelist size.
+         */
+        [[nodiscard]] capsule_pool_stats stats() const
+        {
+            capsule_pool_stats result;
+            result.hits = m_hits.load(std::memory_order_relaxed);
+            result.misses = m_misses.load(std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            result.cached = m_free.size();
+            return result;
+        }
+
+        /**
+         * @brief Reset the hit/miss counters (the pooled objects are kept).
+         */
+        void reset_stats() noexcept
+        {
+            m_hits.store(0, std::memory_order_relaxed);
+            m_misses.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<T*> m_free;
+        std::atomic<std::uint64_t> m_hits{0};
+        std::atomic<std::uint64_t> m_misses{0};
+    };
+
+    /// Pool used for every ``ArrowSchema`` structure allocated by sparrow-rockfinch.
+    SPARROW_ROCKFINCH_API struct_pool<ArrowSchema>& arrow_schema_pool();
+
+    /// Pool used for every ``ArrowArray`` structure allocated by sparrow-rockfinch.
+    SPARROW_ROCKFINCH_API struct_pool<ArrowArray>& arrow_array_pool();
+
+    /// Pool used for every ``ArrowArrayStream`` structure allocated by sparrow-rockfinch.
+    SPARROW_ROCKFINCH_API struct_pool<ArrowArrayStream>& arrow_array_stream_pool();
+
+    /// Pool used for every ``ArrowDeviceArray`` structure allocated by sparrow-rockfinch.
+    SPARROW_ROCKFINCH_API struct_pool<ArrowDeviceArray>& arrow_device_array_pool();
+
+    /// Pool used for every ``ArrowDeviceArrayStream`` structure allocated by sparrow-rockfinch.
+    SPARROW_ROCKFINCH_API struct_pool<ArrowDeviceArrayStream>& arrow_device_array_stream_pool();
+}
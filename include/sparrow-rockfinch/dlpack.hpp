@@ -0,0 +1,125 @@
+/**
+ * @file dlpack.hpp
+ * @brief Structures of the DLPack tensor exchange protocol.
+ *
+ * Definitions copied from DLPack 1.0 (https://github.com/dmlc/dlpack), guarded
+ * so that they give way to another copy of them (e.g. ``dlpack/dlpack.h``)
+ * included first. sparrow-rockfinch only produces and accepts CPU tensors
+ * (``kDLCPU``).
+ *
+ * The definitions below are derived from ``include/dlpack/dlpack.h`` of DLPack:
+ *
+ *   Copyright (c) 2017 by Contributors
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ * Modifications: only the structures, enumerations and macros used by
+ * sparrow-rockfinch are kept, the documentation comments are shortened and
+ * the C++ ``extern "C"`` block replaces the upstream export macros.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+extern "C"
+{
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+#define DLPACK_MAJOR_VERSION 1
+#define DLPACK_MINOR_VERSION 0
+
+    typedef struct
+    {
+        uint32_t major;
+        uint32_t minor;
+    } DLPackVersion;
+
+    typedef enum
+    {
+        kDLCPU = 1,
+        kDLCUDA = 2,
+        kDLCUDAHost = 3,
+        kDLOpenCL = 4,
+        kDLVulkan = 7,
+        kDLMetal = 8,
+        kDLVPI = 9,
+        kDLROCM = 10,
+        kDLROCMHost = 11,
+        kDLExtDev = 12,
+        kDLCUDAManaged = 13,
+        kDLOneAPI = 14,
+        kDLWebGPU = 15,
+        kDLHexagon = 16,
+    } DLDeviceType;
+
+    typedef struct
+    {
+        DLDeviceType device_type;
+        int32_t device_id;
+    } DLDevice;
+
+    typedef enum
+    {
+        kDLInt = 0U,
+        kDLUInt = 1U,
+        kDLFloat = 2U,
+        kDLOpaqueHandle = 3U,
+        kDLBfloat = 4U,
+        kDLComplex = 5U,
+        kDLBool = 6U,
+    } DLDataTypeCode;
+
+    typedef struct
+    {
+        uint8_t code;
+        uint8_t bits;
+        uint16_t lanes;
+    } DLDataType;
+
+    typedef struct
+    {
+        void* data;
+        DLDevice device;
+        int32_t ndim;
+        DLDataType dtype;
+        int64_t* shape;
+        // In elements; NULL for a C-contiguous tensor
+        int64_t* strides;
+        uint64_t byte_offset;
+    } DLTensor;
+
+    // Exchanged in "dltensor" capsules (before DLPack 1.0)
+    typedef struct DLManagedTensor
+    {
+        DLTensor dl_tensor;
+        void* manager_ctx;
+        void (*deleter)(struct DLManagedTensor* self);
+    } DLManagedTensor;
+
+#define DLPACK_FLAG_BITMASK_READ_ONLY (1UL << 0UL)
+#define DLPACK_FLAG_BITMASK_IS_COPIED (1UL << 1UL)
+
+    // Exchanged in "dltensor_versioned" capsules
+    struct DLManagedTensorVersioned
+    {
+        DLPackVersion version;
+        void* manager_ctx;
+        void (*deleter)(struct DLManagedTensorVersioned* self);
+        uint64_t flags;
+        DLTensor dl_tensor;
+    };
+
+#endif  // DLPACK_DLPACK_H_
+}
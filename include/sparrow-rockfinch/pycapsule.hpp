@@ -1,10 +1,16 @@
 #pragma once
 
 #define PY_SSIZE_T_CLEAN
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include <Python.h>
+#include <sparrow-rockfinch/arrow_validate.hpp>
 #include <sparrow-rockfinch/config/config.hpp>
 
 // Forward declarations to avoid including heavy headers
@@ -17,9 +23,17 @@ namespace sparrow
 struct ArrowSchema;
 struct ArrowArray;
 struct ArrowArrayStream;
+struct ArrowDeviceArray;
+struct ArrowDeviceArrayStream;
 
 namespace sparrow::rockfinch
 {
+    namespace detail
+    {
+        class lazy_arrow_array;
+        class shared_arrow_schema;
+    }
+
     /**
      * @brief Imports a sparrow array from schema and array PyCapsules.
      *
@@ -27,11 +41,54 @@ namespace sparrow::rockfinch
      * After successful import, the capsules' release callbacks are set to nullptr,
      * and the returned array owns the data.
      *
+     * With validation_mode::full, the structures are checked with
+     * validate_arrow_array first; an invalid array raises ValueError and the
+     * capsules are left untouched.
+     *
      * @param schema_capsule PyCapsule containing an ArrowSchema
      * @param array_capsule PyCapsule containing an ArrowArray
+     * @param mode Whether to validate the structures before importing them
      * @return A sparrow array constructed from the capsules, or an empty array on error
      */
-    SPARROW_ROCKFINCH_API array import_array_from_capsules(PyObject* schema_capsule, PyObject* array_capsule);
+    SPARROW_ROCKFINCH_API array import_array_from_capsules(
+        PyObject* schema_capsule,
+        PyObject* array_capsule,
+        validation_mode mode = validation_mode::trusted
+    );
+
+    /**
+     * @brief Imports the structures of schema and array PyCapsules without building a sparrow array.
+     *
+     * Transfers ownership like import_array_from_capsules, but the returned holder
+     * keeps the raw ArrowArray and ArrowSchema and only builds the sparrow array
+     * when it is first needed (see detail::lazy_arrow_array).
+     *
+     * @param schema_capsule PyCapsule containing an ArrowSchema
+     * @param array_capsule PyCapsule containing an ArrowArray
+     * @param mode Whether to validate the structures before importing them
+     * @return The holder, or nullptr with a Python error set on error
+     */
+    SPARROW_ROCKFINCH_API std::shared_ptr<detail::lazy_arrow_array> import_lazy_array_from_capsules(
+        PyObject* schema_capsule,
+        PyObject* array_capsule,
+        validation_mode mode = validation_mode::trusted
+    );
+
+    /**
+     * @brief Imports a batch of sparrow arrays from (schema, array) PyCapsule pairs.
+     *
+     * All capsules are validated first (capsule names, structures not already
+     * consumed, no array capsule used twice), then every array is built; the
+     * capsules are only consumed once all of them are, so on error none is.
+     * Equal schemas, whether in the same capsule object or not, are copied once
+     * and shared by the arrays using them.
+     *
+     * @param capsule_pairs Pairs of (schema_capsule, array_capsule)
+     * @return The imported arrays, in input order (empty for an empty batch), or
+     *         std::nullopt with a Python error set on failure
+     */
+    SPARROW_ROCKFINCH_API std::optional<std::vector<array>>
+    import_arrays_from_capsules(std::span<const std::pair<PyObject*, PyObject*>> capsule_pairs);
 
     /**
      * @brief Exports a sparrow array to both schema and array PyCapsules.
@@ -44,10 +101,69 @@ namespace sparrow::rockfinch
      */
     SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_array_to_capsules(array& arr);
 
+    /**
+     * @brief Exports a shared sparrow array to schema and array PyCapsules without copying buffers.
+     *
+     * The exported ArrowArray points to the buffers of @p arr and its private data
+     * holds a reference on @p arr, so the array stays alive until the consumer
+     * releases the capsule data. Repeated exports of the same array cost O(1) memory.
+     * The array must not be mutated while exports are alive.
+     *
+     * @param arr The shared sparrow array to export
+     * @return A pair of (schema_capsule, array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*>
+    export_shared_array_to_capsules(const std::shared_ptr<const array>& arr);
+
+    /**
+     * @brief Exports a shared sparrow array with a cached schema, without copying buffers or schema.
+     *
+     * Same as the single-argument overload, but the schema capsule is produced from
+     * @p schema (see export_shared_schema_to_capsule) instead of a fresh deep copy.
+     *
+     * @param arr The shared sparrow array to export
+     * @param schema The cached schema of @p arr
+     * @return A pair of (schema_capsule, array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_shared_array_to_capsules(
+        const std::shared_ptr<const array>& arr,
+        const detail::shared_arrow_schema& schema
+    );
+
+    /**
+     * @brief Exports an ArrowArray kept alive by a shared owner, without copying buffers or schema.
+     *
+     * Same as the overload above for an ArrowArray that is not (yet) wrapped in a
+     * sparrow array: the exported structures point to the buffers of @p source and
+     * hold a reference on @p owner.
+     *
+     * @param source The ArrowArray to export
+     * @param owner Handle keeping @p source alive and unmodified
+     * @param schema The cached schema of @p source
+     * @return A pair of (schema_capsule, array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_shared_array_to_capsules(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        const detail::shared_arrow_schema& schema
+    );
+
     // ========================================================================
     // ArrowSchema Export (PyCapsule Interface: __arrow_c_schema__)
     // ========================================================================
 
+    /**
+     * @brief Returns the ArrowSchema held by a schema PyCapsule without taking ownership.
+     *
+     * Used to read the ``requested_schema`` argument of the PyCapsule Interface:
+     * the capsule keeps ownership and the pointer is valid as long as it is alive.
+     *
+     * @param schema_capsule PyCapsule containing an ArrowSchema
+     * @return The ArrowSchema, or nullptr with a Python error set if the capsule
+     *         is invalid or its schema has been released
+     */
+    SPARROW_ROCKFINCH_API const ArrowSchema* get_schema_from_capsule(PyObject* schema_capsule);
+
     /**
      * @brief Exports the schema of a sparrow array to a PyCapsule.
      *
@@ -59,6 +175,18 @@ namespace sparrow::rockfinch
      */
     SPARROW_ROCKFINCH_API PyObject* export_schema_to_capsule(const array& arr);
 
+    /**
+     * @brief Exports a cached, immutable schema to a PyCapsule.
+     *
+     * The exported ArrowSchema shares the format strings, names, metadata and
+     * children of @p schema and holds a reference on it, so no string is copied.
+     * Exporting a flat (childless) schema allocates nothing but the capsule itself.
+     *
+     * @param schema The cached schema to export
+     * @return A PyCapsule containing an ArrowSchema, or nullptr on error
+     */
+    SPARROW_ROCKFINCH_API PyObject* export_shared_schema_to_capsule(const detail::shared_arrow_schema& schema);
+
     // ========================================================================
     // ArrowArrayStream Export/Import (PyCapsule Interface: __arrow_c_stream__)
     // ========================================================================
@@ -79,9 +207,164 @@ namespace sparrow::rockfinch
      * Creates a stream proxy from the capsule's stream. The proxy takes ownership
      * of the stream data.
      *
+     * With validation_mode::full, every batch is checked with validate_arrow_array
+     * when it is pulled; an invalid batch is released and makes the stream fail
+     * with EINVAL.
+     *
      * @param stream_capsule PyCapsule containing an ArrowArrayStream
+     * @param mode Whether to validate the batches
      * @return An arrow_array_stream_proxy, or an empty proxy on error
      */
-    SPARROW_ROCKFINCH_API arrow_array_stream_proxy import_stream_proxy_from_capsule(PyObject* stream_capsule);
+    SPARROW_ROCKFINCH_API arrow_array_stream_proxy
+    import_stream_proxy_from_capsule(PyObject* stream_capsule, validation_mode mode = validation_mode::trusted);
+
+    // ========================================================================
+    // Arrow C Device Data Interface (PyCapsule Interface: __arrow_c_device_array__,
+    // __arrow_c_device_stream__). Only CPU data (ARROW_DEVICE_CPU) is supported.
+    // ========================================================================
+
+    /**
+     * @brief Imports a sparrow array from schema and device array PyCapsules.
+     *
+     * Same as import_array_from_capsules for an "arrow_device_array" capsule.
+     *
+     * @param schema_capsule PyCapsule containing an ArrowSchema
+     * @param device_array_capsule PyCapsule containing an ArrowDeviceArray
+     * @param mode Whether to validate the structures before importing them
+     * @return The imported array, or an empty array with a Python error set on error
+     *         (ValueError if the data does not live on the CPU or is invalid)
+     */
+    SPARROW_ROCKFINCH_API array import_array_from_device_capsules(
+        PyObject* schema_capsule,
+        PyObject* device_array_capsule,
+        validation_mode mode = validation_mode::trusted
+    );
+
+    /**
+     * @brief Same as import_lazy_array_from_capsules for an "arrow_device_array" capsule.
+     *
+     * @param schema_capsule PyCapsule containing an ArrowSchema
+     * @param device_array_capsule PyCapsule containing an ArrowDeviceArray
+     * @param mode Whether to validate the structures before importing them
+     * @return The holder, or nullptr with a Python error set on error
+     *         (ValueError if the data does not live on the CPU or is invalid)
+     */
+    SPARROW_ROCKFINCH_API std::shared_ptr<detail::lazy_arrow_array> import_lazy_array_from_device_capsules(
+        PyObject* schema_capsule,
+        PyObject* device_array_capsule,
+        validation_mode mode = validation_mode::trusted
+    );
+
+    /**
+     * @brief Exports a sparrow array to schema and CPU device array PyCapsules.
+     *
+     * Same as export_array_to_capsules, with an "arrow_device_array" capsule.
+     *
+     * @param arr The sparrow array to export (will be moved from)
+     * @return A pair of (schema_capsule, device_array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_array_to_device_capsules(array& arr);
 
+    /**
+     * @brief Exports a shared sparrow array to schema and CPU device array PyCapsules.
+     *
+     * Same as export_shared_array_to_capsules (no buffer or schema copy), with an
+     * "arrow_device_array" capsule.
+     *
+     * @param arr The shared sparrow array to export
+     * @param schema The cached schema of @p arr
+     * @return A pair of (schema_capsule, device_array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_shared_array_to_device_capsules(
+        const std::shared_ptr<const array>& arr,
+        const detail::shared_arrow_schema& schema
+    );
+
+    /**
+     * @brief Same as the ArrowArray overload of export_shared_array_to_capsules, with an
+     *        "arrow_device_array" capsule.
+     *
+     * @param source The ArrowArray to export
+     * @param owner Handle keeping @p source alive and unmodified
+     * @param schema The cached schema of @p source
+     * @return A pair of (schema_capsule, device_array_capsule), or (nullptr, nullptr) on error
+     */
+    SPARROW_ROCKFINCH_API std::pair<PyObject*, PyObject*> export_shared_array_to_device_capsules(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        const detail::shared_arrow_schema& schema
+    );
+
+    /**
+     * @brief Exports an arrow_array_stream_proxy as a CPU ArrowDeviceArrayStream PyCapsule.
+     *
+     * The device stream forwards to the proxy's stream and tags every batch with
+     * ARROW_DEVICE_CPU.
+     *
+     * @param proxy The stream proxy to export
+     * @return A PyCapsule containing an ArrowDeviceArrayStream, or nullptr on error
+     */
+    SPARROW_ROCKFINCH_API PyObject* export_stream_proxy_to_device_capsule(arrow_array_stream_proxy& proxy);
+
+    /**
+     * @brief Imports an arrow_array_stream_proxy from an ArrowDeviceArrayStream PyCapsule.
+     *
+     * The proxy takes ownership of the device stream; a batch that does not live
+     * on the CPU makes the stream fail with EINVAL.
+     *
+     * @param stream_capsule PyCapsule containing an ArrowDeviceArrayStream
+     * @param mode Whether to validate the batches, as in import_stream_proxy_from_capsule
+     * @return An arrow_array_stream_proxy, or an empty proxy with a Python error set
+     *         on error (ValueError if the stream is not a CPU stream)
+     */
+    SPARROW_ROCKFINCH_API arrow_array_stream_proxy import_stream_proxy_from_device_capsule(
+        PyObject* stream_capsule,
+        validation_mode mode = validation_mode::trusted
+    );
+
+    // ========================================================================
+    // Capsule structure pools
+    // ========================================================================
+
+    /**
+     * @brief Counters of one pool of Arrow C structures.
+     *
+     * The ArrowSchema, ArrowArray and ArrowArrayStream structures handed to
+     * capsules (and the child structures of exported trees) are allocated from
+     * freelist pools and returned to them by the capsule destructors.
+     */
+    struct capsule_pool_stats
+    {
+        /// Number of allocations served from the freelist.
+        std::uint64_t hits = 0;
+
+        /// Number of allocations that required a fresh heap allocation.
+        std::uint64_t misses = 0;
+
+        /// Number of structures currently held in the freelist.
+        std::size_t cached = 0;
+    };
+
+    /**
+     * @brief Counters of the ArrowSchema, ArrowArray, ArrowArrayStream, ArrowDeviceArray
+     *        and ArrowDeviceArrayStream pools.
+     */
+    struct capsule_pools_stats
+    {
+        capsule_pool_stats schema;
+        capsule_pool_stats array;
+        capsule_pool_stats stream;
+        capsule_pool_stats device_array;
+        capsule_pool_stats device_stream;
+    };
+
+    /**
+     * @brief Returns a snapshot of the capsule structure pool counters.
+     */
+    SPARROW_ROCKFINCH_API capsule_pools_stats get_capsule_pools_stats();
+
+    /**
+     * @brief Resets the hit/miss counters of the capsule structure pools.
+     */
+    SPARROW_ROCKFINCH_API void reset_capsule_pools_stats();
 }
@@ -2,6 +2,7 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <memory>
 
 #include <sparrow/array.hpp>
 
@@ -10,12 +11,23 @@
 
 namespace sparrow::rockfinch
 {
+    class SparrowRecordBatch;
+
     /**
      * @brief C++ wrapper class for sparrow::array with Python interop.
      *
      * This class wraps a sparrow::array and provides methods for Arrow PyCapsule
      * Interface (ArrowArrayExportable protocol), allowing it to be passed
      * directly to libraries like Polars via pl.from_arrow().
+     *
+     * The wrapped array is held through a reference-counted handle shared with
+     * copies of this object and with the ArrowArray structures it exports, so
+     * exporting never copies buffers. Mutable access detaches (copy-on-write)
+     * when the handle is shared.
+     *
+     * A lazily imported array keeps the producer's ArrowArray and ArrowSchema
+     * and only builds the sparrow array on first typed access, so that
+     * forwarding it or querying its size or schema stays cheap.
      * 
      * Note: This class is designed to be wrapped by nanobind (or similar)
      * in a Python extension module.
@@ -38,6 +50,17 @@ namespace sparrow::rockfinch
          */
         explicit SparrowArray(sparrow::array&& arr);
 
+        /**
+         * @brief Construct a lazy SparrowArray from imported Arrow C structures.
+         *
+         * The typed sparrow array is only built on first call to get_array();
+         * size(), the schema and the (device) capsule exports work on the raw
+         * structures directly.
+         *
+         * @param lazy The imported structures (see import_lazy_array_from_capsules).
+         */
+        explicit SparrowArray(std::shared_ptr<detail::lazy_arrow_array> lazy);
+
         SparrowArray(const SparrowArray& other);
         SparrowArray(SparrowArray&& other) noexcept;
         SparrowArray& operator=(const SparrowArray& other);
@@ -47,13 +70,45 @@ namespace sparrow::rockfinch
         /**
          * @brief Export the array via the Arrow PyCapsule interface (__arrow_c_array__).
          *
+         * The exported ArrowArray shares the buffers of this array (zero-copy) and
+         * keeps them alive until the consumer releases it.
+         *
          * @return A pair of (schema_capsule, array_capsule). Caller owns the references.
          */
         [[nodiscard]] std::pair<PyObject*, PyObject*> export_to_capsules() const;
 
+        /**
+         * @brief Export the array via __arrow_c_array__, honoring a requested schema.
+         *
+         * When @p requested_schema describes another layout that the array can be
+         * cast to (see cast_array), the cast array is exported; subtrees whose layout
+         * already matches are still shared. Otherwise the array is exported as-is.
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A pair of (schema_capsule, array_capsule), or (nullptr, nullptr) with a
+         *         Python error set if @p requested_schema is not a valid schema capsule.
+         */
+        [[nodiscard]] std::pair<PyObject*, PyObject*> export_to_capsules(PyObject* requested_schema) const;
+
+        /**
+         * @brief Export the array via the Arrow PyCapsule interface (__arrow_c_device_array__).
+         *
+         * Same as export_to_capsules(PyObject*), with an ArrowDeviceArray capsule
+         * describing CPU memory (ARROW_DEVICE_CPU).
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A pair of (schema_capsule, device_array_capsule), or (nullptr, nullptr)
+         *         with a Python error set.
+         */
+        [[nodiscard]] std::pair<PyObject*, PyObject*>
+        export_to_device_capsules(PyObject* requested_schema) const;
+
         /**
          * @brief Export the schema via the Arrow PyCapsule interface (__arrow_c_schema__).
          *
+         * The schema is deep-copied once and cached; every capsule then shares this
+         * immutable copy, so repeated calls do not copy strings or children.
+         *
          * @return A PyCapsule containing an ArrowSchema. Caller owns the reference.
          */
         [[nodiscard]] PyObject* export_schema_to_capsule() const;
@@ -65,9 +120,50 @@ namespace sparrow::rockfinch
          */
         [[nodiscard]] size_t size() const;
 
+        /**
+         * @brief Check whether the typed sparrow array has been built.
+         *
+         * Always true unless this object was constructed lazily and get_array()
+         * has not been called yet.
+         *
+         * @return true if the sparrow array exists.
+         */
+        [[nodiscard]] bool is_materialized() const;
+
+        /**
+         * @brief Replace the array by one with 64-byte aligned buffers and zero offsets.
+         *
+         * Only the misaligned or offset buffers are copied (see realign_array); the
+         * others stay shared with the current array. The NumPy owner, if any, is
+         * dropped when the array is replaced. Does nothing, and keeps a lazy array
+         * lazy, when no copy is needed or the layout is not supported.
+         *
+         * @return true if the array was replaced.
+         */
+        bool realign();
+
+        /**
+         * @brief Make this object the only owner of the buffers of its array.
+         *
+         * When the array is shared with copies of this object, with exported
+         * ArrowArray structures or with handles returned by owner(), or when any
+         * of its buffers is borrowed (from an Arrow producer, a NumPy array or
+         * another array), the whole array is copied into buffers it owns (see
+         * copy_array) and the NumPy owner, if any, is dropped. Otherwise nothing
+         * is done, so that only the first of repeated calls copies.
+         *
+         * @return true if the array was copied.
+         */
+        bool make_buffers_exclusive();
+
         /**
          * @brief Get a mutable reference to the underlying sparrow array.
          *
+         * If the array is shared with copies of this object or with exported
+         * ArrowArray structures, it is first copied so that mutations cannot be
+         * observed through them. The NumPy owner, if any, is dropped in that case
+         * since the copy no longer references its memory.
+         *
          * @return The wrapped sparrow array.
          */
         [[nodiscard]] sparrow::array& get_array();
@@ -75,10 +171,47 @@ namespace sparrow::rockfinch
         /**
          * @brief Get a const reference to the underlying sparrow array.
          *
+         * Materializes a lazy array.
+         *
          * @return The wrapped sparrow array.
          */
         [[nodiscard]] const sparrow::array& get_array() const;
 
+        /**
+         * @brief Get a handle keeping the buffers of the current array alive.
+         *
+         * Unlike this object, whose array may later be replaced (see get_array()
+         * and make_buffers_exclusive()), the handle always refers to the current
+         * buffers, so views over them can outlive such replacements.
+         *
+         * @return The reference-counted handle shared with exports and copies.
+         */
+        [[nodiscard]] std::shared_ptr<const void> owner() const;
+
+        /**
+         * @brief Get the handle to give the writable NumPy views of the current array.
+         *
+         * Same as owner(), except that the handle is tracked: while it is alive,
+         * has_writable_view() is true and further calls return it again, so that
+         * all writable views share the same buffers. Replacing the array (see
+         * get_array(), realign() and make_buffers_exclusive()) stops the tracking:
+         * the views keep the previous buffers.
+         *
+         * @return The tracked handle, materializing a lazy array.
+         */
+        [[nodiscard]] std::shared_ptr<const void> writable_view_owner();
+
+        /**
+         * @brief Check whether a writable NumPy view of the current buffers may be alive.
+         *
+         * While it is, the Arrow exports (export_to_capsules(),
+         * export_to_device_capsules()) hand out a copy of the values instead of
+         * the buffers, which the view may still change.
+         *
+         * @return true if a handle returned by writable_view_owner() is alive.
+         */
+        [[nodiscard]] bool has_writable_view() const;
+
         /**
          * @brief Set a NumPy array as the owner of the underlying data.
          *
@@ -105,6 +238,9 @@ namespace sparrow::rockfinch
         [[nodiscard]] bool numpy_owner_writable() const;
 
     private:
+        // Builds and slices struct arrays from the raw structures of its columns
+        friend class SparrowRecordBatch;
+
         /**
          * @brief Release the owned NumPy reference, if any, and reset metadata.
          *
@@ -115,7 +251,49 @@ namespace sparrow::rockfinch
          */
         void clear_numpy_owner();
 
-        sparrow::array m_array;
+        /**
+         * @brief Make sure ``m_array`` is not shared before handing out mutable access.
+         */
+        void detach();
+
+        /**
+         * @brief Build ``m_array`` from the lazy structures, if not done yet.
+         */
+        void materialize() const;
+
+        /**
+         * @brief The ArrowArray to export, without materializing a lazy array.
+         */
+        [[nodiscard]] const ArrowArray& arrow_array() const;
+
+        /**
+         * @brief The ArrowArray to export and the handle keeping it alive.
+         *
+         * A copy of the values while a writable view may change the buffers
+         * (see has_writable_view()), the current array otherwise.
+         */
+        [[nodiscard]] std::pair<const ArrowArray*, std::shared_ptr<const void>> export_source() const;
+
+        /**
+         * @brief Common implementation of the (device) array exports.
+         */
+        [[nodiscard]] std::pair<PyObject*, PyObject*>
+        export_requested(PyObject* requested_schema, bool device) const;
+
+        /**
+         * @brief Return the cached exported schema, building it on first use.
+         *
+         * Like the rest of this class, this is not synchronized: calls are expected
+         * to be serialized (e.g. by the GIL).
+         */
+        [[nodiscard]] const detail::shared_arrow_schema& shared_schema() const;
+
+        // Exactly one of m_array and m_lazy is set; materialize() switches to m_array
+        mutable std::shared_ptr<sparrow::array> m_array;
+        mutable std::shared_ptr<detail::lazy_arrow_array> m_lazy;
+        mutable std::shared_ptr<const detail::shared_arrow_schema> m_schema;
+        // Handle given to the writable NumPy views of m_array (see writable_view_owner())
+        std::weak_ptr<const void> m_writable_view;
         PyObject* m_numpy_owner = nullptr;
         bool m_numpy_owner_writable = false;
     };
@@ -0,0 +1,144 @@
+#pragma once
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sparrow-rockfinch/config/config.hpp"
+#include "sparrow-rockfinch/sparrow_array_python_class.hpp"
+
+namespace sparrow::rockfinch
+{
+    /**
+     * @brief C++ wrapper class for a record batch (a table chunk) with Python interop.
+     *
+     * The columns are the children of a single sparrow struct array, so the whole
+     * batch is exported by __arrow_c_array__ as one struct ArrowArray whose children
+     * share the column buffers, instead of one capsule pair per column.
+     *
+     * Column access is zero-copy as well: each returned SparrowArray is a lazy view
+     * of one child that shares its buffers and keeps the batch data alive, so that
+     * reading a column of a wide batch does not build the other columns.
+     *
+     * Note: This class is designed to be wrapped by nanobind (or similar)
+     * in a Python extension module.
+     */
+    class SPARROW_ROCKFINCH_API SparrowRecordBatch
+    {
+    public:
+        /**
+         * @brief Construct a SparrowRecordBatch from columns and their names.
+         *
+         * The columns are not copied: the children of the struct array share
+         * their buffers.
+         *
+         * @param columns The columns, which must all have the same length.
+         * @param names The column names, one per column.
+         * @throws std::invalid_argument If the numbers of columns and names differ
+         *         or if the columns have different lengths.
+         */
+        SparrowRecordBatch(const std::vector<SparrowArray>& columns, const std::vector<std::string>& names);
+
+        /**
+         * @brief Construct a SparrowRecordBatch from a struct array.
+         *
+         * This is how record batches travel through the Arrow C Data Interface
+         * (e.g. pyarrow.RecordBatch.__arrow_c_array__).
+         *
+         * @param struct_array A SparrowArray whose format is "+s"; a lazy array
+         *        stays lazy.
+         * @throws std::invalid_argument If @p struct_array is not a struct array.
+         */
+        explicit SparrowRecordBatch(SparrowArray struct_array);
+
+        /**
+         * @brief Export the batch as one struct array via __arrow_c_array__.
+         *
+         * Same as SparrowArray::export_to_capsules(PyObject*) for the underlying
+         * struct array: the columns are shared (zero-copy) and a requested struct
+         * schema casts the columns whose layout differs.
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A pair of (schema_capsule, array_capsule), or (nullptr, nullptr) with a
+         *         Python error set.
+         */
+        [[nodiscard]] std::pair<PyObject*, PyObject*> export_to_capsules(PyObject* requested_schema) const;
+
+        /**
+         * @brief Export the batch as one struct array via __arrow_c_device_array__.
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A pair of (schema_capsule, device_array_capsule), or (nullptr, nullptr)
+         *         with a Python error set.
+         */
+        [[nodiscard]] std::pair<PyObject*, PyObject*>
+        export_to_device_capsules(PyObject* requested_schema) const;
+
+        /**
+         * @brief Export the struct schema via __arrow_c_schema__ (cached, see SparrowArray).
+         *
+         * @return A PyCapsule containing an ArrowSchema. Caller owns the reference.
+         */
+        [[nodiscard]] PyObject* export_schema_to_capsule() const;
+
+        /**
+         * @brief Get the number of rows.
+         */
+        [[nodiscard]] std::size_t num_rows() const;
+
+        /**
+         * @brief Get the number of columns.
+         */
+        [[nodiscard]] std::size_t num_columns() const;
+
+        /**
+         * @brief Get the column names, in column order (empty for unnamed columns).
+         */
+        [[nodiscard]] std::vector<std::string> column_names() const;
+
+        /**
+         * @brief Find the index of the first column named @p name.
+         *
+         * @return The column index, or std::nullopt if there is no such column.
+         */
+        [[nodiscard]] std::optional<std::size_t> column_index(std::string_view name) const;
+
+        /**
+         * @brief Get a zero-copy view of a column.
+         *
+         * The returned array is lazy (only its Arrow structures are built) and
+         * shares the column buffers; it keeps them alive after this batch is
+         * destroyed. If the batch is a slice, the view covers the same rows.
+         *
+         * @param index The column index.
+         * @return The column.
+         * @throws std::out_of_range If @p index is not lower than num_columns().
+         */
+        [[nodiscard]] SparrowArray column(std::size_t index) const;
+
+        /**
+         * @brief Get zero-copy views of all the columns (see column()).
+         */
+        [[nodiscard]] std::vector<SparrowArray> columns() const;
+
+        /**
+         * @brief Get the underlying struct array.
+         */
+        [[nodiscard]] const SparrowArray& struct_array() const noexcept;
+
+    private:
+        /**
+         * @brief Build the struct array whose children share the buffers of @p columns.
+         */
+        [[nodiscard]] static SparrowArray
+        make_struct_array(const std::vector<SparrowArray>& columns, const std::vector<std::string>& names);
+
+        SparrowArray m_array;
+    };
+
+}  // namespace sparrow::rockfinch
@@ -64,6 +64,33 @@ namespace sparrow::rockfinch
          */
         PyObject* export_to_capsule();
 
+        /**
+         * Export the stream via the Arrow PyCapsule interface, honoring a requested schema.
+         *
+         * When @p requested_schema describes another layout the stream schema can be
+         * cast to (see can_cast), the exported stream reports @p requested_schema and
+         * casts the batches one at a time as they are read; a batch whose values do
+         * not fit fails get_next with EINVAL. Otherwise the batches are exported with
+         * their native layout.
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A PyCapsule containing an ArrowArrayStream, or nullptr with a Python
+         *         error set.
+         */
+        PyObject* export_to_capsule(PyObject* requested_schema);
+
+        /**
+         * Export the stream via the Arrow PyCapsule interface (__arrow_c_device_stream__).
+         *
+         * Same as export_to_capsule(PyObject*), with an ArrowDeviceArrayStream capsule
+         * whose batches describe CPU memory (ARROW_DEVICE_CPU).
+         *
+         * @param requested_schema PyCapsule containing an ArrowSchema, or nullptr / None.
+         * @return A PyCapsule containing an ArrowDeviceArrayStream, or nullptr with a
+         *         Python error set.
+         */
+        PyObject* export_to_device_capsule(PyObject* requested_schema);
+
         /**
          * Check if the SparrowStream has been consumed via export.
          *
@@ -72,6 +99,22 @@ namespace sparrow::rockfinch
         [[nodiscard]] bool is_consumed() const noexcept;
 
     private:
+        /**
+         * Common implementation of the (device) stream exports.
+         */
+        PyObject* export_requested(PyObject* requested_schema, bool device);
+
+        /**
+         * Export the stream behind an adapter casting its batches to @p requested.
+         *
+         * Falls back to exporting the stream as-is if its schema already has the
+         * requested layout or cannot be cast to it.
+         *
+         * @return A PyCapsule containing an ArrowArrayStream (ArrowDeviceArrayStream if
+         *         @p device), or nullptr on error.
+         */
+        PyObject* export_cast_to_capsule(const ArrowSchema& requested, bool device);
+
         sparrow::arrow_array_stream_proxy m_stream_proxy;
         bool m_consumed = false;
     };
@@ -0,0 +1,606 @@
+/**
+ * @file arrow_align.cpp
+ * @brief Alignment-normalizing copy of imported arrays (``align=True`` import option).
+ *
+ * Every node of the result has a zero offset and 64-byte aligned buffers.
+ * A buffer is copied only when the range it contributes does not already
+ * start on a 64-byte boundary; everything else is shared with the source.
+ * ``copy_array`` uses the same builder with every buffer copied.
+ */
+
+#include <sparrow-rockfinch/arrow_align.hpp>
+
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+#include <sparrow-rockfinch/detail/shared_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        using detail::shared_arrow_array_private_data;
+
+        std::atomic<std::uint64_t> arrays_checked_counter{0};
+        std::atomic<std::uint64_t> arrays_realigned_counter{0};
+        std::atomic<std::uint64_t> buffers_copied_counter{0};
+        std::atomic<std::uint64_t> bytes_copied_counter{0};
+
+        enum class node_layout
+        {
+            null,
+            boolean,
+            fixed_width,
+            binary,
+            large_binary,
+            list,
+            large_list,
+            fixed_size_list,
+            structure
+        };
+
+        struct node_format
+        {
+            node_layout layout;
+            // Byte width of fixed_width values, list size of fixed_size_list
+            std::size_t size = 0;
+        };
+
+        std::optional<std::size_t> parse_size(std::string_view digits) noexcept
+        {
+            std::size_t value = 0;
+            const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+            if (ec != std::errc{} || ptr != digits.data() + digits.size() || value == 0)
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        std::optional<std::size_t> temporal_width(std::string_view format) noexcept
+        {
+            if (format == "tdD" || format == "tts" || format == "ttm" || format == "tiM")
+            {
+                return 4;
+            }
+            if (format == "tdm" || format == "ttu" || format == "ttn" || format == "tiD" || format.starts_with("ts")
+                || format.starts_with("tD"))
+            {
+                return 8;
+            }
+            if (format == "tin")
+            {
+                return 16;
+            }
+            return std::nullopt;
+        }
+
+        std::optional<node_format> node_format_from(std::string_view format) noexcept
+        {
+            if (format == "n")
+            {
+                return node_format{node_layout::null};
+            }
+            if (format == "b")
+            {
+                return node_format{node_layout::boolean};
+            }
+            if (format.size() == 1)
+            {
+                switch (format[0])
+                {
+                    case 'c':
+                    case 'C':
+                        return node_format{node_layout::fixed_width, 1};
+                    case 's':
+                    case 'S':
+                    case 'e':
+                        return node_format{node_layout::fixed_width, 2};
+                    case 'i':
+                    case 'I':
+                    case 'f':
+                        return node_format{node_layout::fixed_width, 4};
+                    case 'l':
+                    case 'L':
+                    case 'g':
+                        return node_format{node_layout::fixed_width, 8};
+                    case 'z':
+                    case 'u':
+                        return node_format{node_layout::binary};
+                    case 'Z':
+                    case 'U':
+                        return node_format{node_layout::large_binary};
+                    default:
+                        return std::nullopt;
+                }
+            }
+            if (format.starts_with("d:"))
+            {
+                // d:precision,scale[,bitwidth], 128 bits by default
+                const std::size_t first_comma = format.find(',');
+                const std::size_t second_comma = format.find(',', first_comma + 1);
+                if (first_comma == std::string_view::npos || second_comma == std::string_view::npos)
+                {
+                    return node_format{node_layout::fixed_width, 16};
+                }
+                const auto bits = parse_size(format.substr(second_comma + 1));
+                if (!bits.has_value() || *bits % 8 != 0)
+                {
+                    return std::nullopt;
+                }
+                return node_format{node_layout::fixed_width, *bits / 8};
+            }
+            if (format.starts_with("w:"))
+            {
+                const auto width = parse_size(format.substr(2));
+                return width.has_value() ? std::optional(node_format{node_layout::fixed_width, *width}) : std::nullopt;
+            }
+            if (format.starts_with("t"))
+            {
+                const auto width = temporal_width(format);
+                return width.has_value() ? std::optional(node_format{node_layout::fixed_width, *width}) : std::nullopt;
+            }
+            if (format == "+l" || format == "+m")
+            {
+                return node_format{node_layout::list};
+            }
+            if (format == "+L")
+            {
+                return node_format{node_layout::large_list};
+            }
+            if (format.starts_with("+w:"))
+            {
+                const auto list_size = parse_size(format.substr(3));
+                return list_size.has_value() ? std::optional(node_format{node_layout::fixed_size_list, *list_size})
+                                             : std::nullopt;
+            }
+            if (format == "+s")
+            {
+                return node_format{node_layout::structure};
+            }
+            return std::nullopt;
+        }
+
+        bool is_aligned(const void* ptr) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr) % detail::arrow_buffer_alignment == 0;
+        }
+
+        // Builds the realigned tree; counts the copies it makes
+        class realigner
+        {
+        public:
+
+            // With `copy_all`, every buffer is copied, aligned or not, and nothing
+            // is shared with the source
+            explicit realigner(const std::shared_ptr<const void>& owner, bool copy_all = false)
+                : m_owner(owner)
+                , m_copy_all(copy_all)
+            {
+            }
+
+            // Fills `target` with the [begin, begin + length) range of `source`
+            // (indices in its buffers, offset included) at offset 0; leaves `target`
+            // released on failure
+            bool fill(
+                const ArrowArray& source,
+                const ArrowSchema& schema,
+                std::size_t begin,
+                std::size_t length,
+                ArrowArray& target
+            )
+            {
+                const std::optional<node_format> format = node_format_from(schema.format);
+                if (!format.has_value() || source.n_children != schema.n_children
+                    || (source.dictionary != nullptr && format->layout != node_layout::fixed_width))
+                {
+                    return false;
+                }
+
+                target = ArrowArray{};
+                auto* data = new shared_arrow_array_private_data{};
+                data->owner = m_owner;
+                target.private_data = data;
+                target.release = &detail::release_shared_arrow_array;
+
+                // From now on, the release callback cleans up partially built children
+                bool filled = false;
+                try
+                {
+                    filled = fill_buffers(source, schema, *format, begin, length, *data);
+                }
+                catch (...)
+                {
+                    target.release(&target);
+                    throw;
+                }
+                if (!filled)
+                {
+                    target.release(&target);
+                    return false;
+                }
+
+                target.length = static_cast<std::int64_t>(length);
+                target.null_count = null_count(source, format->layout, begin, length);
+                target.offset = 0;
+                target.n_buffers = static_cast<std::int64_t>(data->buffers.size());
+                target.n_children = static_cast<std::int64_t>(data->children.size());
+                target.buffers = data->buffers.empty() ? nullptr : data->buffers.data();
+                target.children = data->children.empty() ? nullptr : data->children.data();
+                target.dictionary = data->dictionary;
+                return true;
+            }
+
+            std::uint64_t buffers_copied() const noexcept
+            {
+                return m_buffers_copied;
+            }
+
+            std::uint64_t bytes_copied() const noexcept
+            {
+                return m_bytes_copied;
+            }
+
+        private:
+
+            static std::int64_t
+            null_count(const ArrowArray& source, node_layout layout, std::size_t begin, std::size_t length)
+            {
+                if (layout == node_layout::null)
+                {
+                    return static_cast<std::int64_t>(length);
+                }
+                const auto* bitmap = static_cast<const std::uint8_t*>(source.buffers[0]);
+                if (bitmap == nullptr || source.null_count == 0)
+                {
+                    return 0;
+                }
+                if (begin == static_cast<std::size_t>(source.offset) && length == static_cast<std::size_t>(source.length))
+                {
+                    return source.null_count;
+                }
+                return static_cast<std::int64_t>(length - detail::count_set_bits(bitmap, begin, begin + length));
+            }
+
+            std::byte* allocate(std::size_t size, shared_arrow_array_private_data& data)
+            {
+                auto buffer = detail::make_aligned_buffer(size);
+                std::byte* ptr = buffer.get();
+                data.storage.push_back(std::move(buffer));
+                ++m_buffers_copied;
+                m_bytes_copied += size;
+                return ptr;
+            }
+
+            // Bitmap starting at bit `begin`, re-based at bit 0
+            const void* bits(const void* buffer, std::size_t begin, std::size_t length, shared_arrow_array_private_data& data)
+            {
+                if (buffer == nullptr)
+                {
+                    return nullptr;
+                }
+                const auto* bitmap = static_cast<const std::uint8_t*>(buffer);
+                if (!m_copy_all && begin % 8 == 0 && is_aligned(bitmap + begin / 8))
+                {
+                    return bitmap + begin / 8;
+                }
+                auto* out = reinterpret_cast<std::uint8_t*>(allocate((length + 7) / 8, data));
+                detail::copy_bits(bitmap, begin, out, length);
+                return out;
+            }
+
+            const void* validity(const ArrowArray& source, std::size_t begin, std::size_t length, shared_arrow_array_private_data& data)
+            {
+                if (source.null_count == 0)
+                {
+                    return nullptr;
+                }
+                return bits(source.buffers[0], begin, length, data);
+            }
+
+            const void* bytes(const void* buffer, std::size_t begin, std::size_t size, shared_arrow_array_private_data& data)
+            {
+                if (buffer == nullptr)
+                {
+                    return nullptr;
+                }
+                const std::byte* first = static_cast<const std::byte*>(buffer) + begin;
+                if (!m_copy_all && is_aligned(first))
+                {
+                    return first;
+                }
+                std::byte* out = allocate(size, data);
+                std::memcpy(out, first, size);
+                return out;
+            }
+
+            // Offsets of [begin, begin + length] re-based at 0; returns the source range they cover
+            template <class T>
+            std::pair<std::size_t, std::size_t>
+            offsets(const ArrowArray& source, std::size_t begin, std::size_t length, shared_arrow_array_private_data& data)
+            {
+                const T* values = static_cast<const T*>(source.buffers[1]);
+                if (values == nullptr)
+                {
+                    // Only valid for empty arrays: expose the single 0 offset
+                    auto buffer = detail::make_aligned_buffer(sizeof(T));
+                    data.buffers.push_back(buffer.get());
+                    data.storage.push_back(std::move(buffer));
+                    return {0, 0};
+                }
+
+                const T* range = values + begin;
+                const T first = range[0];
+                if (!m_copy_all && first == 0 && is_aligned(range))
+                {
+                    data.buffers.push_back(range);
+                }
+                else
+                {
+                    T* out = reinterpret_cast<T*>(allocate((length + 1) * sizeof(T), data));
+                    for (std::size_t i = 0; i <= length; ++i)
+                    {
+                        out[i] = static_cast<T>(range[i] - first);
+                    }
+                    data.buffers.push_back(out);
+                }
+                return {static_cast<std::size_t>(first), static_cast<std::size_t>(range[length])};
+            }
+
+            bool fill_child(
+                const ArrowArray& source,
+                const ArrowSchema& schema,
+                std::size_t index,
+                std::size_t begin,
+                std::size_t length,
+                shared_arrow_array_private_data& data
+            )
+            {
+                const ArrowArray& child = *source.children[index];
+                data.children.push_back(detail::arrow_array_pool().acquire());
+                return fill(
+                    child,
+                    *schema.children[index],
+                    static_cast<std::size_t>(child.offset) + begin,
+                    length,
+                    *data.children.back()
+                );
+            }
+
+            bool fill_buffers(
+                const ArrowArray& source,
+                const ArrowSchema& schema,
+                const node_format& format,
+                std::size_t begin,
+                std::size_t length,
+                shared_arrow_array_private_data& data
+            )
+            {
+                switch (format.layout)
+                {
+                    case node_layout::null:
+                        return true;
+                    case node_layout::boolean:
+                        data.buffers = {validity(source, begin, length, data), bits(source.buffers[1], begin, length, data)};
+                        return true;
+                    case node_layout::fixed_width:
+                        data.buffers = {
+                            validity(source, begin, length, data),
+                            bytes(source.buffers[1], begin * format.size, length * format.size, data)
+                        };
+                        if (source.dictionary != nullptr)
+                        {
+                            const ArrowArray& dictionary = *source.dictionary;
+                            data.dictionary = detail::arrow_array_pool().acquire();
+                            return fill(
+                                dictionary,
+                                *schema.dictionary,
+                                static_cast<std::size_t>(dictionary.offset),
+                                static_cast<std::size_t>(dictionary.length),
+                                *data.dictionary
+                            );
+                        }
+                        return true;
+                    case node_layout::binary:
+                    case node_layout::large_binary:
+                    {
+                        data.buffers = {validity(source, begin, length, data)};
+                        const auto [first, last] = format.layout == node_layout::binary
+                                                       ? offsets<std::int32_t>(source, begin, length, data)
+                                                       : offsets<std::int64_t>(source, begin, length, data);
+                        data.buffers.push_back(bytes(source.buffers[2], first, last - first, data));
+                        return true;
+                    }
+                    case node_layout::list:
+                    case node_layout::large_list:
+                    {
+                        if (source.n_children != 1)
+                        {
+                            return false;
+                        }
+                        data.buffers = {validity(source, begin, length, data)};
+                        const auto [first, last] = format.layout == node_layout::list
+                                                       ? offsets<std::int32_t>(source, begin, length, data)
+                                                       : offsets<std::int64_t>(source, begin, length, data);
+                        return fill_child(source, schema, 0, first, last - first, data);
+                    }
+                    case node_layout::fixed_size_list:
+                        if (source.n_children != 1)
+                        {
+                            return false;
+                        }
+                        data.buffers = {validity(source, begin, length, data)};
+                        return fill_child(source, schema, 0, begin * format.size, length * format.size, data);
+                    case node_layout::structure:
+                        data.buffers = {validity(source, begin, length, data)};
+                        for (std::size_t i = 0; i < static_cast<std::size_t>(source.n_children); ++i)
+                        {
+                            if (!fill_child(source, schema, i, begin, length, data))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                }
+                return false;
+            }
+
+            std::shared_ptr<const void> m_owner;
+            bool m_copy_all;
+            std::uint64_t m_buffers_copied = 0;
+            std::uint64_t m_bytes_copied = 0;
+        };
+    }
+
+    bool needs_realignment(const ArrowArray& array) noexcept
+    {
+        if (array.offset != 0)
+        {
+            return true;
+        }
+        for (std::int64_t i = 0; i < array.n_buffers; ++i)
+        {
+            if (!is_aligned(array.buffers[i]))
+            {
+                return true;
+            }
+        }
+        for (std::int64_t i = 0; i < array.n_children; ++i)
+        {
+            if (needs_realignment(*array.children[i]))
+            {
+                return true;
+            }
+        }
+        return array.dictionary != nullptr && needs_realignment(*array.dictionary);
+    }
+
+    std::optional<array>
+    realign_array(const ArrowArray& source, const ArrowSchema& schema, const std::shared_ptr<const void>& owner)
+    {
+        arrays_checked_counter.fetch_add(1, std::memory_order_relaxed);
+        if (!needs_realignment(source))
+        {
+            return std::nullopt;
+        }
+
+        realigner builder(owner);
+        ArrowArray aligned{};
+        if (!builder.fill(
+                source,
+                schema,
+                static_cast<std::size_t>(source.offset),
+                static_cast<std::size_t>(source.length),
+                aligned
+            ))
+        {
+            return std::nullopt;
+        }
+
+        ArrowSchema aligned_schema{};
+        try
+        {
+            sparrow::copy_schema(schema, aligned_schema);
+        }
+        catch (...)
+        {
+            aligned.release(&aligned);
+            throw;
+        }
+
+        arrays_realigned_counter.fetch_add(1, std::memory_order_relaxed);
+        buffers_copied_counter.fetch_add(builder.buffers_copied(), std::memory_order_relaxed);
+        bytes_copied_counter.fetch_add(builder.bytes_copied(), std::memory_order_relaxed);
+        return array(std::move(aligned), std::move(aligned_schema));
+    }
+
+    std::optional<array> copy_array(const ArrowArray& source, const ArrowSchema& schema)
+    {
+        realigner builder(nullptr, true);
+        ArrowArray copied{};
+        if (!builder.fill(
+                source,
+                schema,
+                static_cast<std::size_t>(source.offset),
+                static_cast<std::size_t>(source.length),
+                copied
+            ))
+        {
+            return std::nullopt;
+        }
+
+        ArrowSchema copied_schema{};
+        try
+        {
+            sparrow::copy_schema(schema, copied_schema);
+        }
+        catch (...)
+        {
+            copied.release(&copied);
+            throw;
+        }
+        return array(std::move(copied), std::move(copied_schema));
+    }
+
+    bool owns_all_buffers(const ArrowArray& array) noexcept
+    {
+        if (array.release != &detail::release_shared_arrow_array)
+        {
+            return false;
+        }
+        const auto& data = *static_cast<const shared_arrow_array_private_data*>(array.private_data);
+        for (std::int64_t i = 0; i < array.n_buffers; ++i)
+        {
+            const void* buffer = array.buffers[i];
+            const bool owned = buffer == nullptr
+                               || std::ranges::any_of(
+                                   data.storage,
+                                   [buffer](const detail::aligned_buffer& stored)
+                                   {
+                                       return stored.get() == buffer;
+                                   }
+                               );
+            if (!owned)
+            {
+                return false;
+            }
+        }
+        for (std::int64_t i = 0; i < array.n_children; ++i)
+        {
+            if (!owns_all_buffers(*array.children[i]))
+            {
+                return false;
+            }
+        }
+        return array.dictionary == nullptr || owns_all_buffers(*array.dictionary);
+    }
+
+    realign_stats get_realign_stats() noexcept
+    {
+        realign_stats stats;
+        stats.arrays_checked = arrays_checked_counter.load(std::memory_order_relaxed);
+        stats.arrays_realigned = arrays_realigned_counter.load(std::memory_order_relaxed);
+        stats.buffers_copied = buffers_copied_counter.load(std::memory_order_relaxed);
+        stats.bytes_copied = bytes_copied_counter.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void reset_realign_stats() noexcept
+    {
+        arrays_checked_counter.store(0, std::memory_order_relaxed);
+        arrays_realigned_counter.store(0, std::memory_order_relaxed);
+        buffers_copied_counter.store(0, std::memory_order_relaxed);
+        bytes_copied_counter.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,502 @@
+/**
+ * @file arrow_cast.cpp
+ * @brief Cast engine behind the ``requested_schema`` argument of the PyCapsule Interface.
+ *
+ * The kernels are plain contiguous loops over the value and offset buffers so
+ * that the compiler vectorizes them; everything else (validity bitmaps,
+ * character data, children with a matching layout) is shared with the source.
+ */
+
+#include <sparrow-rockfinch/arrow_cast.hpp>
+
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+#include <sparrow-rockfinch/detail/shared_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/arrow_interface/arrow_array.hpp>
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        using detail::shared_arrow_array_private_data;
+
+        enum class numeric_type
+        {
+            int8,
+            uint8,
+            int16,
+            uint16,
+            int32,
+            uint32,
+            int64,
+            uint64,
+            float32,
+            float64
+        };
+
+        std::optional<numeric_type> numeric_type_from_format(std::string_view format) noexcept
+        {
+            if (format.size() != 1)
+            {
+                return std::nullopt;
+            }
+            switch (format[0])
+            {
+                case 'c':
+                    return numeric_type::int8;
+                case 'C':
+                    return numeric_type::uint8;
+                case 's':
+                    return numeric_type::int16;
+                case 'S':
+                    return numeric_type::uint16;
+                case 'i':
+                    return numeric_type::int32;
+                case 'I':
+                    return numeric_type::uint32;
+                case 'l':
+                    return numeric_type::int64;
+                case 'L':
+                    return numeric_type::uint64;
+                case 'f':
+                    return numeric_type::float32;
+                case 'g':
+                    return numeric_type::float64;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        template <class F>
+        decltype(auto) visit_numeric_type(numeric_type type, F&& f)
+        {
+            switch (type)
+            {
+                case numeric_type::int8:
+                    return f(std::type_identity<std::int8_t>{});
+                case numeric_type::uint8:
+                    return f(std::type_identity<std::uint8_t>{});
+                case numeric_type::int16:
+                    return f(std::type_identity<std::int16_t>{});
+                case numeric_type::uint16:
+                    return f(std::type_identity<std::uint16_t>{});
+                case numeric_type::int32:
+                    return f(std::type_identity<std::int32_t>{});
+                case numeric_type::uint32:
+                    return f(std::type_identity<std::uint32_t>{});
+                case numeric_type::int64:
+                    return f(std::type_identity<std::int64_t>{});
+                case numeric_type::uint64:
+                    return f(std::type_identity<std::uint64_t>{});
+                case numeric_type::float32:
+                    return f(std::type_identity<float>{});
+                case numeric_type::float64:
+                default:
+                    return f(std::type_identity<double>{});
+            }
+        }
+
+        // Whether every value of From is representable in To (precision loss
+        // of integer to floating-point casts is accepted, as in Arrow)
+        template <class From, class To>
+        constexpr bool always_fits() noexcept
+        {
+            if constexpr (std::is_floating_point_v<To>)
+            {
+                return true;
+            }
+            else
+            {
+                return std::in_range<To>(std::numeric_limits<From>::min())
+                       && std::in_range<To>(std::numeric_limits<From>::max());
+            }
+        }
+
+        using detail::bit_is_set;
+
+        // Validity bitmap of `source` re-based at offset 0: shared when the offset
+        // is byte-aligned, copied into `data.storage` otherwise
+        const void* rebase_validity(const ArrowArray& source, shared_arrow_array_private_data& data)
+        {
+            if (source.n_buffers == 0 || source.buffers[0] == nullptr || source.null_count == 0)
+            {
+                return nullptr;
+            }
+            const auto* bitmap = static_cast<const std::uint8_t*>(source.buffers[0]);
+            const auto offset = static_cast<std::size_t>(source.offset);
+            if (offset % 8 == 0)
+            {
+                return bitmap + offset / 8;
+            }
+            const auto length = static_cast<std::size_t>(source.length);
+            auto buffer = detail::make_aligned_buffer((length + 7) / 8);
+            auto* out = reinterpret_cast<std::uint8_t*>(buffer.get());
+            detail::copy_bits(bitmap, offset, out, length);
+            data.storage.push_back(std::move(buffer));
+            return out;
+        }
+
+        template <class From, class To>
+        void convert_values(const From* in, To* out, std::size_t size) noexcept
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                out[i] = static_cast<To>(in[i]);
+            }
+        }
+
+        // Checks that the non-null values of `values` are representable in To
+        template <class From, class To>
+        bool values_fit(const From* values, const std::uint8_t* bitmap, std::size_t offset, std::size_t length) noexcept
+        {
+            if constexpr (always_fits<From, To>())
+            {
+                return true;
+            }
+            else
+            {
+                if (bitmap == nullptr)
+                {
+                    if (length == 0)
+                    {
+                        return true;
+                    }
+                    From lowest = values[0];
+                    From highest = values[0];
+                    for (std::size_t i = 1; i < length; ++i)
+                    {
+                        lowest = values[i] < lowest ? values[i] : lowest;
+                        highest = values[i] > highest ? values[i] : highest;
+                    }
+                    return std::in_range<To>(lowest) && std::in_range<To>(highest);
+                }
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (bit_is_set(bitmap, offset + i) && !std::in_range<To>(values[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        template <class From, class To>
+        bool cast_numeric(const ArrowArray& source, shared_arrow_array_private_data& data)
+        {
+            const auto offset = static_cast<std::size_t>(source.offset);
+            const auto length = static_cast<std::size_t>(source.length);
+            const From* values = static_cast<const From*>(source.buffers[1]);
+            if (values != nullptr)
+            {
+                values += offset;
+                const auto* bitmap = source.null_count != 0 ? static_cast<const std::uint8_t*>(source.buffers[0])
+                                                            : nullptr;
+                if (!values_fit<From, To>(values, bitmap, offset, length))
+                {
+                    return false;
+                }
+            }
+
+            const void* validity = rebase_validity(source, data);
+            auto buffer = detail::make_aligned_buffer(length * sizeof(To));
+            if (values != nullptr)
+            {
+                convert_values(values, reinterpret_cast<To*>(buffer.get()), length);
+            }
+            data.buffers = {validity, buffer.get()};
+            data.storage.push_back(std::move(buffer));
+            return true;
+        }
+
+        template <class From, class To>
+        bool cast_offsets(const ArrowArray& source, shared_arrow_array_private_data& data)
+        {
+            const auto offset = static_cast<std::size_t>(source.offset);
+            const auto length = static_cast<std::size_t>(source.length);
+            const From* offsets = static_cast<const From*>(source.buffers[1]);
+
+            // Offsets are absolute positions in the character data, which is shared as-is
+            auto buffer = detail::make_aligned_buffer((length + 1) * sizeof(To));
+            if (offsets != nullptr)
+            {
+                offsets += offset;
+                if constexpr (!always_fits<From, To>())
+                {
+                    if (!std::in_range<To>(offsets[length]))
+                    {
+                        return false;
+                    }
+                }
+                convert_values(offsets, reinterpret_cast<To*>(buffer.get()), length + 1);
+            }
+
+            const void* validity = rebase_validity(source, data);
+            data.buffers = {validity, buffer.get(), source.buffers[2]};
+            data.storage.push_back(std::move(buffer));
+            return true;
+        }
+
+        bool cast_node(
+            const ArrowArray& source,
+            const ArrowSchema& source_schema,
+            const ArrowSchema& requested,
+            const std::shared_ptr<const void>& owner,
+            ArrowArray& target
+        );
+
+        bool cast_struct(
+            const ArrowArray& source,
+            const ArrowSchema& source_schema,
+            const ArrowSchema& requested,
+            const std::shared_ptr<const void>& owner,
+            shared_arrow_array_private_data& data
+        )
+        {
+            if (source.n_children != requested.n_children || source.n_children != source_schema.n_children)
+            {
+                return false;
+            }
+            // The struct offset applies to the children, so they are cast over their
+            // whole range and the parent keeps its offset and validity bitmap
+            data.buffers = {source.n_buffers > 0 ? source.buffers[0] : nullptr};
+            data.children.reserve(static_cast<std::size_t>(source.n_children));
+            for (std::int64_t i = 0; i < source.n_children; ++i)
+            {
+                data.children.push_back(detail::arrow_array_pool().acquire());
+                if (!cast_node(
+                        *source.children[i],
+                        *source_schema.children[i],
+                        *requested.children[i],
+                        owner,
+                        *data.children.back()
+                    ))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool cast_buffers(
+            const ArrowArray& source,
+            const ArrowSchema& source_schema,
+            const ArrowSchema& requested,
+            const std::shared_ptr<const void>& owner,
+            shared_arrow_array_private_data& data
+        )
+        {
+            const std::string_view from = source_schema.format;
+            const std::string_view to = requested.format;
+
+            const auto from_numeric = numeric_type_from_format(from);
+            const auto to_numeric = numeric_type_from_format(to);
+            if (from_numeric.has_value() && to_numeric.has_value())
+            {
+                return visit_numeric_type(
+                    *from_numeric,
+                    [&]<class From>(std::type_identity<From>)
+                    {
+                        return visit_numeric_type(
+                            *to_numeric,
+                            [&]<class To>(std::type_identity<To>)
+                            {
+                                if constexpr (std::is_floating_point_v<From> && std::is_integral_v<To>)
+                                {
+                                    return false;
+                                }
+                                else
+                                {
+                                    return cast_numeric<From, To>(source, data);
+                                }
+                            }
+                        );
+                    }
+                );
+            }
+
+            if ((from == "u" && to == "U") || (from == "z" && to == "Z"))
+            {
+                return cast_offsets<std::int32_t, std::int64_t>(source, data);
+            }
+            if ((from == "U" && to == "u") || (from == "Z" && to == "z"))
+            {
+                return cast_offsets<std::int64_t, std::int32_t>(source, data);
+            }
+
+            if (from == "+s" && to == "+s")
+            {
+                return cast_struct(source, source_schema, requested, owner, data);
+            }
+            return false;
+        }
+
+        // Fills `target` with `source` cast to `requested`; leaves `target` released on failure
+        bool cast_node(
+            const ArrowArray& source,
+            const ArrowSchema& source_schema,
+            const ArrowSchema& requested,
+            const std::shared_ptr<const void>& owner,
+            ArrowArray& target
+        )
+        {
+            if (has_same_layout(source_schema, requested))
+            {
+                detail::make_shared_arrow_array(source, owner, target);
+                return true;
+            }
+            if (source.dictionary != nullptr || requested.dictionary != nullptr)
+            {
+                return false;
+            }
+
+            target = ArrowArray{};
+            auto* data = new shared_arrow_array_private_data{};
+            data->owner = owner;
+            target.private_data = data;
+            target.release = &detail::release_shared_arrow_array;
+
+            // From now on, the release callback cleans up partially built children
+            bool cast = false;
+            try
+            {
+                cast = cast_buffers(source, source_schema, requested, owner, *data);
+            }
+            catch (...)
+            {
+                target.release(&target);
+                throw;
+            }
+            if (!cast)
+            {
+                target.release(&target);
+                return false;
+            }
+
+            // Structs keep their offset (see cast_struct), other nodes are re-based at 0
+            const bool is_struct = std::string_view(requested.format) == "+s";
+            target.length = source.length;
+            target.null_count = source.null_count;
+            target.offset = is_struct ? source.offset : 0;
+            target.n_buffers = static_cast<std::int64_t>(data->buffers.size());
+            target.n_children = static_cast<std::int64_t>(data->children.size());
+            target.buffers = data->buffers.data();
+            target.children = data->children.empty() ? nullptr : data->children.data();
+            return true;
+        }
+    }
+
+    bool has_same_layout(const ArrowSchema& lhs, const ArrowSchema& rhs) noexcept
+    {
+        if (std::strcmp(lhs.format, rhs.format) != 0 || lhs.n_children != rhs.n_children)
+        {
+            return false;
+        }
+        for (std::int64_t i = 0; i < lhs.n_children; ++i)
+        {
+            if (!has_same_layout(*lhs.children[i], *rhs.children[i]))
+            {
+                return false;
+            }
+        }
+        if ((lhs.dictionary == nullptr) != (rhs.dictionary == nullptr))
+        {
+            return false;
+        }
+        return lhs.dictionary == nullptr || has_same_layout(*lhs.dictionary, *rhs.dictionary);
+    }
+
+    bool can_cast(const ArrowSchema& source, const ArrowSchema& requested) noexcept
+    {
+        if (has_same_layout(source, requested))
+        {
+            return true;
+        }
+        if (source.dictionary != nullptr || requested.dictionary != nullptr)
+        {
+            return false;
+        }
+
+        // Mirrors cast_buffers
+        const std::string_view from = source.format;
+        const std::string_view to = requested.format;
+        const auto from_numeric = numeric_type_from_format(from);
+        const auto to_numeric = numeric_type_from_format(to);
+        if (from_numeric.has_value() && to_numeric.has_value())
+        {
+            const bool from_floating = *from_numeric == numeric_type::float32 || *from_numeric == numeric_type::float64;
+            const bool to_floating = *to_numeric == numeric_type::float32 || *to_numeric == numeric_type::float64;
+            return !from_floating || to_floating;
+        }
+        if ((from == "u" && to == "U") || (from == "z" && to == "Z") || (from == "U" && to == "u")
+            || (from == "Z" && to == "z"))
+        {
+            return true;
+        }
+        if (from == "+s" && to == "+s" && source.n_children == requested.n_children)
+        {
+            for (std::int64_t i = 0; i < source.n_children; ++i)
+            {
+                if (!can_cast(*source.children[i], *requested.children[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    std::optional<array> cast_array(const std::shared_ptr<const array>& source, const ArrowSchema& requested)
+    {
+        return cast_array(*sparrow::get_arrow_array(*source), *sparrow::get_arrow_schema(*source), source, requested);
+    }
+
+    std::optional<array> cast_array(
+        const ArrowArray& source,
+        const ArrowSchema& source_schema,
+        const std::shared_ptr<const void>& owner,
+        const ArrowSchema& requested
+    )
+    {
+        ArrowArray cast{};
+        if (!cast_arrow_array(source, source_schema, owner, requested, cast))
+        {
+            return std::nullopt;
+        }
+
+        ArrowSchema cast_schema{};
+        try
+        {
+            sparrow::copy_schema(requested, cast_schema);
+        }
+        catch (...)
+        {
+            cast.release(&cast);
+            throw;
+        }
+        return array(std::move(cast), std::move(cast_schema));
+    }
+
+    bool cast_arrow_array(
+        const ArrowArray& source,
+        const ArrowSchema& source_schema,
+        const std::shared_ptr<const void>& owner,
+        const ArrowSchema& requested,
+        ArrowArray& target
+    )
+    {
+        return cast_node(source, source_schema, requested, owner, target);
+    }
+}
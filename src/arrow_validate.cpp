@@ -0,0 +1,686 @@
+/**
+ * @file arrow_validate.cpp
+ * @brief Validation of imported Arrow C structures (``validate="full"`` import mode).
+ *
+ * The per-element kernels (bitmap population counts, offsets monotonicity,
+ * ASCII detection, index ranges) work on whole 64-bit words or are written
+ * as branch-free reductions so that the compiler vectorizes them; the scalar
+ * UTF-8 decoder only runs on strings that are not pure ASCII.
+ */
+
+#include <sparrow-rockfinch/arrow_validate.hpp>
+
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include <sparrow/c_interface.hpp>
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        enum class layout_kind
+        {
+            null,
+            boolean,
+            fixed_width,
+            fixed_size_binary,
+            binary,
+            large_binary,
+            utf8,
+            large_utf8,
+            binary_view,
+            list,
+            large_list,
+            list_view,
+            large_list_view,
+            fixed_size_list,
+            structure,
+            map,
+            dense_union,
+            sparse_union,
+            run_end_encoded
+        };
+
+        struct format_layout
+        {
+            layout_kind kind;
+            // Expected number of buffers; -1 for the variadic binary views (at least 3)
+            std::int64_t n_buffers;
+            // Expected number of children; -1 when any number is allowed
+            std::int64_t n_children;
+            // Byte width of fixed_size_binary, list size of fixed_size_list
+            std::int64_t fixed_size = 0;
+        };
+
+        std::optional<std::int64_t> parse_fixed_size(std::string_view digits) noexcept
+        {
+            std::int64_t value = 0;
+            const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+            if (ec != std::errc{} || ptr != digits.data() + digits.size() || value <= 0)
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        std::optional<format_layout> layout_from_format(std::string_view format) noexcept
+        {
+            if (format == "n")
+            {
+                return format_layout{layout_kind::null, 0, 0};
+            }
+            if (format == "b")
+            {
+                return format_layout{layout_kind::boolean, 2, 0};
+            }
+            if (format.size() == 1 && std::string_view("cCsSiIlLefg").find(format[0]) != std::string_view::npos)
+            {
+                return format_layout{layout_kind::fixed_width, 2, 0};
+            }
+            if (format == "z" || format == "Z" || format == "u" || format == "U")
+            {
+                constexpr layout_kind kinds[] = {
+                    layout_kind::binary,
+                    layout_kind::large_binary,
+                    layout_kind::utf8,
+                    layout_kind::large_utf8
+                };
+                return format_layout{kinds[std::string_view("zZuU").find(format[0])], 3, 0};
+            }
+            if (format == "vz" || format == "vu")
+            {
+                return format_layout{layout_kind::binary_view, -1, 0};
+            }
+            if (format.starts_with("d:") || format.starts_with("t"))
+            {
+                return format_layout{layout_kind::fixed_width, 2, 0};
+            }
+            if (format.starts_with("w:"))
+            {
+                const auto size = parse_fixed_size(format.substr(2));
+                if (!size.has_value())
+                {
+                    return std::nullopt;
+                }
+                return format_layout{layout_kind::fixed_size_binary, 2, 0, *size};
+            }
+            if (format == "+l")
+            {
+                return format_layout{layout_kind::list, 2, 1};
+            }
+            if (format == "+L")
+            {
+                return format_layout{layout_kind::large_list, 2, 1};
+            }
+            if (format == "+vl")
+            {
+                return format_layout{layout_kind::list_view, 3, 1};
+            }
+            if (format == "+vL")
+            {
+                return format_layout{layout_kind::large_list_view, 3, 1};
+            }
+            if (format.starts_with("+w:"))
+            {
+                const auto size = parse_fixed_size(format.substr(3));
+                if (!size.has_value())
+                {
+                    return std::nullopt;
+                }
+                return format_layout{layout_kind::fixed_size_list, 1, 1, *size};
+            }
+            if (format == "+s")
+            {
+                return format_layout{layout_kind::structure, 1, -1};
+            }
+            if (format == "+m")
+            {
+                return format_layout{layout_kind::map, 2, 1};
+            }
+            if (format.starts_with("+ud:"))
+            {
+                return format_layout{layout_kind::dense_union, 2, -1};
+            }
+            if (format.starts_with("+us:"))
+            {
+                return format_layout{layout_kind::sparse_union, 1, -1};
+            }
+            if (format == "+r")
+            {
+                return format_layout{layout_kind::run_end_encoded, 0, 2};
+            }
+            return std::nullopt;
+        }
+
+        constexpr bool has_validity_bitmap(layout_kind kind) noexcept
+        {
+            return kind != layout_kind::null && kind != layout_kind::dense_union
+                   && kind != layout_kind::sparse_union && kind != layout_kind::run_end_encoded;
+        }
+
+        // ====================================================================
+        // Kernels
+        // ====================================================================
+
+        // A null bitmap means that every slot is valid
+        bool is_valid_slot(const std::uint8_t* bitmap, std::int64_t i) noexcept
+        {
+            return bitmap == nullptr || detail::bit_is_set(bitmap, static_cast<std::size_t>(i));
+        }
+
+        // Checks offsets[0..count] for monotonicity; returns the first faulty index or -1
+        template <class T>
+        std::int64_t find_decreasing_offset(const T* offsets, std::int64_t count) noexcept
+        {
+            // Branch-free reduction first, the position is only searched on failure
+            bool decreasing = false;
+            for (std::int64_t i = 0; i < count; ++i)
+            {
+                decreasing |= offsets[i + 1] < offsets[i];
+            }
+            if (!decreasing)
+            {
+                return -1;
+            }
+            for (std::int64_t i = 0; i < count; ++i)
+            {
+                if (offsets[i + 1] < offsets[i])
+                {
+                    return i + 1;
+                }
+            }
+            return -1;
+        }
+
+        bool is_ascii(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+            std::uint64_t merged = 0;
+            std::size_t i = 0;
+            for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, data + i, sizeof(word));
+                merged |= word;
+            }
+            for (; i < size; ++i)
+            {
+                merged |= data[i];
+            }
+            return (merged & high_bits) == 0;
+        }
+
+        bool is_valid_utf8(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+            std::size_t i = 0;
+            while (i < size)
+            {
+                // Skip ASCII runs a word at a time
+                while (size - i >= sizeof(std::uint64_t))
+                {
+                    std::uint64_t word = 0;
+                    std::memcpy(&word, data + i, sizeof(word));
+                    if ((word & high_bits) != 0)
+                    {
+                        break;
+                    }
+                    i += sizeof(std::uint64_t);
+                }
+                if (i == size)
+                {
+                    break;
+                }
+
+                const std::uint8_t lead = data[i];
+                if (lead < 0x80)
+                {
+                    ++i;
+                    continue;
+                }
+
+                std::size_t continuation = 0;
+                std::uint32_t code_point = 0;
+                if (lead >= 0xC2 && lead <= 0xDF)
+                {
+                    continuation = 1;
+                    code_point = lead & 0x1Fu;
+                }
+                else if ((lead & 0xF0u) == 0xE0u)
+                {
+                    continuation = 2;
+                    code_point = lead & 0x0Fu;
+                }
+                else if (lead >= 0xF0 && lead <= 0xF4)
+                {
+                    continuation = 3;
+                    code_point = lead & 0x07u;
+                }
+                else
+                {
+                    return false;
+                }
+
+                if (size - i <= continuation)
+                {
+                    return false;
+                }
+                for (std::size_t k = 1; k <= continuation; ++k)
+                {
+                    const std::uint8_t byte = data[i + k];
+                    if ((byte & 0xC0u) != 0x80u)
+                    {
+                        return false;
+                    }
+                    code_point = (code_point << 6) | (byte & 0x3Fu);
+                }
+
+                // Overlong encodings, surrogates and values above U+10FFFF
+                if ((continuation == 2 && (code_point < 0x800 || (code_point >= 0xD800 && code_point <= 0xDFFF)))
+                    || (continuation == 3 && (code_point < 0x10000 || code_point > 0x10FFFF)))
+                {
+                    return false;
+                }
+                i += continuation + 1;
+            }
+            return true;
+        }
+
+        // ====================================================================
+        // Checks
+        // ====================================================================
+
+        class array_validator
+        {
+        public:
+
+            std::optional<std::string> run(const ArrowArray& array, const ArrowSchema& schema)
+            {
+                check(array, schema, "array");
+                return m_error;
+            }
+
+        private:
+
+            bool fail(const std::string& path, std::string_view message)
+            {
+                m_error = path + ": " + std::string(message);
+                return false;
+            }
+
+            bool check(const ArrowArray& array, const ArrowSchema& schema, const std::string& path)
+            {
+                if (schema.release == nullptr || schema.format == nullptr)
+                {
+                    return fail(path, "the schema is released or has no format");
+                }
+                if (array.release == nullptr)
+                {
+                    return fail(path, "the array has been released");
+                }
+                if (array.length < 0 || array.offset < 0)
+                {
+                    return fail(path, "negative length or offset");
+                }
+                if (array.length > std::numeric_limits<std::int64_t>::max() - array.offset)
+                {
+                    return fail(path, "offset + length overflows");
+                }
+                if (array.null_count < -1 || array.null_count > array.length)
+                {
+                    return fail(
+                        path,
+                        "null_count " + std::to_string(array.null_count) + " is out of range for length "
+                            + std::to_string(array.length)
+                    );
+                }
+
+                const std::string_view format(schema.format);
+                const std::optional<format_layout> layout = layout_from_format(format);
+                if (!layout.has_value())
+                {
+                    return fail(path, "unsupported format '" + std::string(format) + "'");
+                }
+                if (schema.dictionary != nullptr && layout->kind != layout_kind::fixed_width)
+                {
+                    return fail(path, "dictionary indices must have an integer format");
+                }
+
+                if (!check_structure(array, schema, *layout, path))
+                {
+                    return false;
+                }
+                if (has_validity_bitmap(layout->kind) && !check_null_count(array, path))
+                {
+                    return false;
+                }
+                if (!check_buffers(array, schema, *layout, path))
+                {
+                    return false;
+                }
+
+                for (std::int64_t i = 0; i < array.n_children; ++i)
+                {
+                    const auto index = static_cast<std::size_t>(i);
+                    if (!check(*array.children[index], *schema.children[index], path + ".children[" + std::to_string(i) + "]"))
+                    {
+                        return false;
+                    }
+                }
+                if (schema.dictionary != nullptr)
+                {
+                    return check(*array.dictionary, *schema.dictionary, path + ".dictionary")
+                           && check_dictionary_indices(array, format, path);
+                }
+                return true;
+            }
+
+            bool check_structure(
+                const ArrowArray& array,
+                const ArrowSchema& schema,
+                const format_layout& layout,
+                const std::string& path
+            )
+            {
+                const bool buffer_count_ok = layout.n_buffers >= 0 ? array.n_buffers == layout.n_buffers
+                                                                   : array.n_buffers >= 3;
+                if (!buffer_count_ok)
+                {
+                    return fail(path, "unexpected number of buffers " + std::to_string(array.n_buffers));
+                }
+                if (array.n_buffers > 0 && array.buffers == nullptr)
+                {
+                    return fail(path, "the buffers pointer is null");
+                }
+                if (array.n_children != schema.n_children
+                    || (layout.n_children >= 0 && array.n_children != layout.n_children))
+                {
+                    return fail(path, "unexpected number of children " + std::to_string(array.n_children));
+                }
+                if (array.n_children > 0 && (array.children == nullptr || schema.children == nullptr))
+                {
+                    return fail(path, "the children pointer is null");
+                }
+                for (std::int64_t i = 0; i < array.n_children; ++i)
+                {
+                    const auto index = static_cast<std::size_t>(i);
+                    if (array.children[index] == nullptr || schema.children[index] == nullptr)
+                    {
+                        return fail(path, "child " + std::to_string(i) + " is null");
+                    }
+                }
+                if ((schema.dictionary == nullptr) != (array.dictionary == nullptr))
+                {
+                    return fail(path, "the dictionary does not match the schema");
+                }
+                return true;
+            }
+
+            bool check_null_count(const ArrowArray& array, const std::string& path)
+            {
+                const auto* bitmap = static_cast<const std::uint8_t*>(array.buffers[0]);
+                if (bitmap == nullptr)
+                {
+                    return array.null_count <= 0 || fail(path, "null_count is positive without a validity bitmap");
+                }
+                if (array.null_count < 0)
+                {
+                    return true;
+                }
+                const auto valid = static_cast<std::int64_t>(detail::count_set_bits(
+                    bitmap,
+                    static_cast<std::size_t>(array.offset),
+                    static_cast<std::size_t>(array.offset + array.length)
+                ));
+                if (array.length - valid != array.null_count)
+                {
+                    return fail(
+                        path,
+                        "null_count " + std::to_string(array.null_count) + " does not match the "
+                            + std::to_string(array.length - valid) + " nulls of the validity bitmap"
+                    );
+                }
+                return true;
+            }
+
+            bool require_buffer(const ArrowArray& array, std::size_t index, const std::string& path)
+            {
+                return array.length == 0 || array.buffers[index] != nullptr
+                       || fail(path, "buffer " + std::to_string(index) + " is null");
+            }
+
+            bool check_buffers(
+                const ArrowArray& array,
+                const ArrowSchema& schema,
+                const format_layout& layout,
+                const std::string& path
+            )
+            {
+                const std::int64_t end = array.offset + array.length;
+                switch (layout.kind)
+                {
+                    case layout_kind::boolean:
+                    case layout_kind::fixed_width:
+                    case layout_kind::fixed_size_binary:
+                        return require_buffer(array, 1, path);
+                    case layout_kind::binary:
+                    case layout_kind::utf8:
+                        return check_variable_size<std::int32_t>(array, layout.kind == layout_kind::utf8, path);
+                    case layout_kind::large_binary:
+                    case layout_kind::large_utf8:
+                        return check_variable_size<std::int64_t>(array, layout.kind == layout_kind::large_utf8, path);
+                    case layout_kind::list:
+                    case layout_kind::map:
+                        return check_list_offsets<std::int32_t>(array, path);
+                    case layout_kind::large_list:
+                        return check_list_offsets<std::int64_t>(array, path);
+                    case layout_kind::list_view:
+                        return check_list_views<std::int32_t>(array, path);
+                    case layout_kind::large_list_view:
+                        return check_list_views<std::int64_t>(array, path);
+                    case layout_kind::fixed_size_list:
+                        if (end > std::numeric_limits<std::int64_t>::max() / layout.fixed_size
+                            || array.children[0]->length < end * layout.fixed_size)
+                        {
+                            return fail(path, "the child is too short for the fixed-size lists");
+                        }
+                        return true;
+                    case layout_kind::structure:
+                        for (std::int64_t i = 0; i < schema.n_children; ++i)
+                        {
+                            if (array.children[static_cast<std::size_t>(i)]->length < end)
+                            {
+                                return fail(path, "child " + std::to_string(i) + " is shorter than the struct");
+                            }
+                        }
+                        return true;
+                    default:
+                        // Structural checks only
+                        return true;
+                }
+            }
+
+            template <class T>
+            bool check_offsets(const ArrowArray& array, const std::string& path)
+            {
+                if (!require_buffer(array, 1, path))
+                {
+                    return false;
+                }
+                if (array.length == 0)
+                {
+                    return true;
+                }
+                const T* offsets = static_cast<const T*>(array.buffers[1]) + array.offset;
+                if (offsets[0] < 0)
+                {
+                    return fail(path, "negative first offset");
+                }
+                const std::int64_t bad = find_decreasing_offset(offsets, array.length);
+                if (bad >= 0)
+                {
+                    return fail(path, "offsets decrease at index " + std::to_string(bad));
+                }
+                return true;
+            }
+
+            template <class T>
+            bool check_variable_size(const ArrowArray& array, bool utf8, const std::string& path)
+            {
+                if (!check_offsets<T>(array, path))
+                {
+                    return false;
+                }
+                if (array.length == 0)
+                {
+                    return true;
+                }
+                const T* offsets = static_cast<const T*>(array.buffers[1]) + array.offset;
+                const auto* data = static_cast<const std::uint8_t*>(array.buffers[2]);
+                const auto first = static_cast<std::size_t>(offsets[0]);
+                const auto last = static_cast<std::size_t>(offsets[array.length]);
+                if (last == first)
+                {
+                    return true;
+                }
+                if (data == nullptr)
+                {
+                    return fail(path, "buffer 2 is null");
+                }
+                // Fast path: pure ASCII data is valid whatever the value boundaries
+                if (!utf8 || is_ascii(data + first, last - first))
+                {
+                    return true;
+                }
+                const auto* bitmap = static_cast<const std::uint8_t*>(array.buffers[0]);
+                for (std::int64_t i = 0; i < array.length; ++i)
+                {
+                    const auto begin = static_cast<std::size_t>(offsets[i]);
+                    const auto value_end = static_cast<std::size_t>(offsets[i + 1]);
+                    if (is_valid_slot(bitmap, array.offset + i) && !is_valid_utf8(data + begin, value_end - begin))
+                    {
+                        return fail(path, "invalid UTF-8 in value " + std::to_string(i));
+                    }
+                }
+                return true;
+            }
+
+            template <class T>
+            bool check_list_offsets(const ArrowArray& array, const std::string& path)
+            {
+                if (!check_offsets<T>(array, path))
+                {
+                    return false;
+                }
+                if (array.length == 0)
+                {
+                    return true;
+                }
+                const T* offsets = static_cast<const T*>(array.buffers[1]) + array.offset;
+                if (static_cast<std::int64_t>(offsets[array.length]) > array.children[0]->length)
+                {
+                    return fail(path, "offsets point past the end of the child");
+                }
+                return true;
+            }
+
+            template <class T>
+            bool check_list_views(const ArrowArray& array, const std::string& path)
+            {
+                if (!require_buffer(array, 1, path) || !require_buffer(array, 2, path))
+                {
+                    return false;
+                }
+                const auto* bitmap = static_cast<const std::uint8_t*>(array.buffers[0]);
+                const T* offsets = static_cast<const T*>(array.buffers[1]);
+                const T* sizes = static_cast<const T*>(array.buffers[2]);
+                const std::int64_t child_length = array.children[0]->length;
+                for (std::int64_t i = array.offset; i < array.offset + array.length; ++i)
+                {
+                    if (!is_valid_slot(bitmap, i))
+                    {
+                        continue;
+                    }
+                    const auto offset = static_cast<std::int64_t>(offsets[i]);
+                    const auto size = static_cast<std::int64_t>(sizes[i]);
+                    if (offset < 0 || size < 0 || offset > child_length - size)
+                    {
+                        return fail(path, "list view " + std::to_string(i - array.offset) + " is out of range");
+                    }
+                }
+                return true;
+            }
+
+            template <class T>
+            bool check_indices(const ArrowArray& array, std::int64_t dictionary_length, const std::string& path)
+            {
+                const auto* bitmap = static_cast<const std::uint8_t*>(array.buffers[0]);
+                const T* indices = static_cast<const T*>(array.buffers[1]) + array.offset;
+                if (array.null_count == 0 || bitmap == nullptr)
+                {
+                    // Branch-free range reduction
+                    bool out_of_range = false;
+                    for (std::int64_t i = 0; i < array.length; ++i)
+                    {
+                        const auto index = static_cast<std::int64_t>(indices[i]);
+                        out_of_range |= index < 0 || index >= dictionary_length;
+                    }
+                    return !out_of_range || fail(path, "dictionary index out of range");
+                }
+                for (std::int64_t i = 0; i < array.length; ++i)
+                {
+                    const auto index = static_cast<std::int64_t>(indices[i]);
+                    if (is_valid_slot(bitmap, array.offset + i) && (index < 0 || index >= dictionary_length))
+                    {
+                        return fail(path, "dictionary index out of range at " + std::to_string(i));
+                    }
+                }
+                return true;
+            }
+
+            bool check_dictionary_indices(const ArrowArray& array, std::string_view format, const std::string& path)
+            {
+                if (array.length == 0)
+                {
+                    return true;
+                }
+                const std::int64_t dictionary_length = array.dictionary->length;
+                switch (format.size() == 1 ? format[0] : '\0')
+                {
+                    case 'c':
+                        return check_indices<std::int8_t>(array, dictionary_length, path);
+                    case 'C':
+                        return check_indices<std::uint8_t>(array, dictionary_length, path);
+                    case 's':
+                        return check_indices<std::int16_t>(array, dictionary_length, path);
+                    case 'S':
+                        return check_indices<std::uint16_t>(array, dictionary_length, path);
+                    case 'i':
+                        return check_indices<std::int32_t>(array, dictionary_length, path);
+                    case 'I':
+                        return check_indices<std::uint32_t>(array, dictionary_length, path);
+                    case 'l':
+                        return check_indices<std::int64_t>(array, dictionary_length, path);
+                    case 'L':
+                        return check_indices<std::uint64_t>(array, dictionary_length, path);
+                    default:
+                        return fail(path, "dictionary indices must have an integer format");
+                }
+            }
+
+            std::optional<std::string> m_error;
+        };
+    }
+
+    std::optional<std::string> validate_arrow_array(const ArrowArray& array, const ArrowSchema& schema)
+    {
+        return array_validator().run(array, schema);
+    }
+}
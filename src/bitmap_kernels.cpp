@@ -0,0 +1,399 @@
+/**
+ * @file bitmap_kernels.cpp
+ * @brief Implementation of the bitmap kernels.
+ */
+
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+
+#include <bit>
+#include <cstring>
+
+// SSE2 is part of the x86-64 baseline. AVX2 is compiled with a function-level
+// target attribute and selected at run time, so no ISA flag is needed.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define SPARROW_ROCKFINCH_BITMAP_SSE2 1
+#    include <emmintrin.h>
+#else
+#    define SPARROW_ROCKFINCH_BITMAP_SSE2 0
+#endif
+
+#if SPARROW_ROCKFINCH_BITMAP_SSE2 && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    define SPARROW_ROCKFINCH_BITMAP_AVX2 1
+#    include <immintrin.h>
+#else
+#    define SPARROW_ROCKFINCH_BITMAP_AVX2 0
+#endif
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        // Spread the 8 bits of `byte` over the 8 bytes of a word (bit j in byte j,
+        // little endian), each byte being 0 or 1. The multiplication places the
+        // 7 low bits without carries; the last one is moved separately.
+        std::uint64_t spread_bits(std::uint8_t byte) noexcept
+        {
+            constexpr std::uint64_t lane_lsbs = 0x0101010101010101ULL;
+            const std::uint64_t low = ((byte & 0x7Fu) * 0x0002040810204081ULL) & lane_lsbs;
+            return low | (static_cast<std::uint64_t>(byte >> 7) << 56);
+        }
+
+        // Unpack whole bitmap bytes into 8 bools each
+        using unpack_bytes_fn = void (*)(const std::uint8_t*, std::size_t, bool*, bool) noexcept;
+
+        void unpack_bytes_portable(const std::uint8_t* bytes, std::size_t n_bytes, bool* out, bool invert) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                const std::uint64_t flip = invert ? spread_bits(0xFF) : 0;
+                for (std::size_t i = 0; i < n_bytes; ++i)
+                {
+                    const std::uint64_t lanes = spread_bits(bytes[i]) ^ flip;
+                    std::memcpy(out + 8 * i, &lanes, sizeof(lanes));
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < 8 * n_bytes; ++i)
+                {
+                    out[i] = bit_is_set(bytes, i) != invert;
+                }
+            }
+        }
+
+#if SPARROW_ROCKFINCH_BITMAP_SSE2
+        // 2 bitmap bytes -> 16 bools: broadcast each byte over 8 lanes, then test
+        // lane j against bit j
+        void unpack_bytes_sse2(const std::uint8_t* bytes, std::size_t n_bytes, bool* out, bool invert) noexcept
+        {
+            const __m128i bit_masks = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            const __m128i ones = _mm_set1_epi8(1);
+            std::size_t i = 0;
+            for (; n_bytes - i >= 2; i += 2, out += 16)
+            {
+                std::uint16_t pair = 0;
+                std::memcpy(&pair, bytes + i, sizeof(pair));
+                __m128i lanes = _mm_cvtsi32_si128(pair);
+                lanes = _mm_unpacklo_epi8(lanes, lanes);
+                lanes = _mm_unpacklo_epi16(lanes, lanes);
+                lanes = _mm_unpacklo_epi32(lanes, lanes);
+                const __m128i set = _mm_cmpeq_epi8(_mm_and_si128(lanes, bit_masks), bit_masks);
+                const __m128i result = invert ? _mm_andnot_si128(set, ones) : _mm_and_si128(set, ones);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+            }
+            unpack_bytes_portable(bytes + i, n_bytes - i, out, invert);
+        }
+#endif
+
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+        // 4 bitmap bytes -> 32 bools; _mm256_shuffle_epi8 works within 128-bit
+        // lanes, so the low lane spreads bytes 0-1 and the high lane bytes 2-3
+        __attribute__((target("avx2"))) void
+        unpack_bytes_avx2(const std::uint8_t* bytes, std::size_t n_bytes, bool* out, bool invert) noexcept
+        {
+            const __m256i spread = _mm256_setr_epi8(
+                0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3
+            );
+            const __m256i bit_masks = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+            const __m256i ones = _mm256_set1_epi8(1);
+            std::size_t i = 0;
+            for (; n_bytes - i >= 4; i += 4, out += 32)
+            {
+                std::int32_t quad = 0;
+                std::memcpy(&quad, bytes + i, sizeof(quad));
+                const __m256i lanes = _mm256_shuffle_epi8(_mm256_set1_epi32(quad), spread);
+                const __m256i set = _mm256_cmpeq_epi8(_mm256_and_si256(lanes, bit_masks), bit_masks);
+                const __m256i result = invert ? _mm256_andnot_si256(set, ones) : _mm256_and_si256(set, ones);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+            }
+            unpack_bytes_portable(bytes + i, n_bytes - i, out, invert);
+        }
+#endif
+
+        unpack_bytes_fn select_unpack_bytes() noexcept
+        {
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return &unpack_bytes_avx2;
+            }
+#endif
+#if SPARROW_ROCKFINCH_BITMAP_SSE2
+            return &unpack_bytes_sse2;
+#else
+            return &unpack_bytes_portable;
+#endif
+        }
+
+        // Resolved once, when the library is loaded
+        const unpack_bytes_fn unpack_bytes = select_unpack_bytes();
+
+        // Pack groups of 8 bytes into whole bitmap bytes; returns the number of set bits
+        using pack_bytes_fn = std::size_t (*)(const std::uint8_t*, std::size_t, std::uint8_t*, bool) noexcept;
+
+        std::size_t pack_bytes_portable(const std::uint8_t* values, std::size_t n_bytes, std::uint8_t* out, bool invert) noexcept
+        {
+            constexpr std::uint64_t lane_lsbs = 0x0101010101010101ULL;
+            const std::uint8_t flip = invert ? 0xFF : 0x00;
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n_bytes; ++i)
+            {
+                std::uint8_t byte = 0;
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    std::uint64_t lanes = 0;
+                    std::memcpy(&lanes, values + 8 * i, sizeof(lanes));
+                    // Fold each byte onto its lowest bit (any non-zero byte is true), then
+                    // gather the 8 lowest bits into the top byte
+                    lanes |= lanes >> 4;
+                    lanes |= lanes >> 2;
+                    lanes |= lanes >> 1;
+                    byte = static_cast<std::uint8_t>(((lanes & lane_lsbs) * 0x0102040810204080ULL) >> 56);
+                }
+                else
+                {
+                    for (std::size_t j = 0; j < 8; ++j)
+                    {
+                        byte |= static_cast<std::uint8_t>((values[8 * i + j] != 0) << j);
+                    }
+                }
+                byte ^= flip;
+                out[i] = byte;
+                count += static_cast<std::size_t>(std::popcount(byte));
+            }
+            return count;
+        }
+
+#if SPARROW_ROCKFINCH_BITMAP_SSE2
+        // 16 values -> 2 bitmap bytes: compare with zero and gather the byte signs
+        std::size_t pack_bytes_sse2(const std::uint8_t* values, std::size_t n_bytes, std::uint8_t* out, bool invert) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; n_bytes - i >= 2; i += 2, values += 16)
+            {
+                const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+                const auto is_zero = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lanes, zero)));
+                const auto bits = static_cast<std::uint16_t>(invert ? is_zero : ~is_zero);
+                std::memcpy(out + i, &bits, sizeof(bits));
+                count += static_cast<std::size_t>(std::popcount(bits));
+            }
+            return count + pack_bytes_portable(values, n_bytes - i, out + i, invert);
+        }
+#endif
+
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+        // 32 values -> 4 bitmap bytes
+        __attribute__((target("avx2"))) std::size_t
+        pack_bytes_avx2(const std::uint8_t* values, std::size_t n_bytes, std::uint8_t* out, bool invert) noexcept
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; n_bytes - i >= 4; i += 4, values += 32)
+            {
+                const __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+                const auto is_zero = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lanes, zero)));
+                const std::uint32_t bits = invert ? is_zero : ~is_zero;
+                std::memcpy(out + i, &bits, sizeof(bits));
+                count += static_cast<std::size_t>(std::popcount(bits));
+            }
+            return count + pack_bytes_portable(values, n_bytes - i, out + i, invert);
+        }
+#endif
+
+        pack_bytes_fn select_pack_bytes() noexcept
+        {
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return &pack_bytes_avx2;
+            }
+#endif
+#if SPARROW_ROCKFINCH_BITMAP_SSE2
+            return &pack_bytes_sse2;
+#else
+            return &pack_bytes_portable;
+#endif
+        }
+
+        const pack_bytes_fn pack_bytes = select_pack_bytes();
+
+        // Compare groups of 8 values with a sentinel into whole bitmap bytes (set
+        // when different); returns the number of set bits
+        using pack_not_equal_bytes_fn = std::size_t (*)(const std::int64_t*, std::size_t, std::int64_t, std::uint8_t*) noexcept;
+
+        std::size_t pack_not_equal_bytes_portable(
+            const std::int64_t* values,
+            std::size_t n_bytes,
+            std::int64_t sentinel,
+            std::uint8_t* out
+        ) noexcept
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n_bytes; ++i, values += 8)
+            {
+                unsigned byte = 0;
+                for (std::size_t j = 0; j < 8; ++j)
+                {
+                    byte |= static_cast<unsigned>(values[j] != sentinel) << j;
+                }
+                out[i] = static_cast<std::uint8_t>(byte);
+                count += static_cast<std::size_t>(std::popcount(byte));
+            }
+            return count;
+        }
+
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+        // 8 values -> 1 bitmap byte: two 64-bit compares, sign bits gathered as doubles
+        __attribute__((target("avx2"))) std::size_t pack_not_equal_bytes_avx2(
+            const std::int64_t* values,
+            std::size_t n_bytes,
+            std::int64_t sentinel,
+            std::uint8_t* out
+        ) noexcept
+        {
+            const __m256i needle = _mm256_set1_epi64x(sentinel);
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n_bytes; ++i, values += 8)
+            {
+                const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+                const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + 4));
+                const auto low_equal = static_cast<unsigned>(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, needle)))
+                );
+                const auto high_equal = static_cast<unsigned>(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, needle)))
+                );
+                const auto byte = static_cast<std::uint8_t>(~(low_equal | (high_equal << 4)));
+                out[i] = byte;
+                count += static_cast<std::size_t>(std::popcount(byte));
+            }
+            return count;
+        }
+#endif
+
+        pack_not_equal_bytes_fn select_pack_not_equal_bytes() noexcept
+        {
+#if SPARROW_ROCKFINCH_BITMAP_AVX2
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return &pack_not_equal_bytes_avx2;
+            }
+#endif
+            return &pack_not_equal_bytes_portable;
+        }
+
+        const pack_not_equal_bytes_fn pack_not_equal_bytes = select_pack_not_equal_bytes();
+    }
+
+    std::size_t count_set_bits(const std::uint8_t* bitmap, std::size_t begin, std::size_t end) noexcept
+    {
+        std::size_t count = 0;
+        std::size_t i = begin;
+        for (; i < end && i % 8 != 0; ++i)
+        {
+            count += bit_is_set(bitmap, i) ? 1u : 0u;
+        }
+        const std::uint8_t* bytes = bitmap + i / 8;
+        for (; end - i >= 64; i += 64, bytes += 8)
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, bytes, sizeof(word));
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+        for (; end - i >= 8; i += 8, ++bytes)
+        {
+            count += static_cast<std::size_t>(std::popcount(*bytes));
+        }
+        for (; i < end; ++i)
+        {
+            count += bit_is_set(bitmap, i) ? 1u : 0u;
+        }
+        return count;
+    }
+
+    void copy_bits(const std::uint8_t* source, std::size_t source_offset, std::uint8_t* target, std::size_t length) noexcept
+    {
+        if (length == 0)
+        {
+            return;
+        }
+        const std::size_t n_bytes = (length + 7) / 8;
+        const std::uint8_t* first = source + source_offset / 8;
+        const std::size_t shift = source_offset % 8;
+        if (shift == 0)
+        {
+            std::memcpy(target, first, n_bytes);
+        }
+        else
+        {
+            // Each output byte straddles two input bytes; the last one may not exist
+            const std::size_t n_source_bytes = (shift + length + 7) / 8;
+            for (std::size_t i = 0; i < n_bytes; ++i)
+            {
+                const unsigned low = first[i] >> shift;
+                const unsigned high = i + 1 < n_source_bytes ? static_cast<unsigned>(first[i + 1]) << (8 - shift) : 0u;
+                target[i] = static_cast<std::uint8_t>(low | high);
+            }
+        }
+        if (length % 8 != 0)
+        {
+            target[n_bytes - 1] = static_cast<std::uint8_t>(target[n_bytes - 1] & ((1u << (length % 8)) - 1));
+        }
+    }
+
+    void unpack_bits(const std::uint8_t* bitmap, std::size_t offset, std::size_t length, bool* out, bool invert) noexcept
+    {
+        static_assert(sizeof(bool) == 1);
+        std::size_t i = 0;
+        for (; i < length && (offset + i) % 8 != 0; ++i)
+        {
+            out[i] = bit_is_set(bitmap, offset + i) != invert;
+        }
+        const std::size_t n_bytes = (length - i) / 8;
+        unpack_bytes(bitmap + (offset + i) / 8, n_bytes, out + i, invert);
+        i += 8 * n_bytes;
+        for (; i < length; ++i)
+        {
+            out[i] = bit_is_set(bitmap, offset + i) != invert;
+        }
+    }
+
+    std::size_t pack_bits(const std::uint8_t* values, std::size_t length, std::uint8_t* out, bool invert) noexcept
+    {
+        const std::size_t n_bytes = length / 8;
+        std::size_t count = pack_bytes(values, n_bytes, out, invert);
+        if (length % 8 != 0)
+        {
+            unsigned last = 0;
+            for (std::size_t i = 8 * n_bytes; i < length; ++i)
+            {
+                last |= static_cast<unsigned>((values[i] != 0) != invert) << (i % 8);
+            }
+            out[n_bytes] = static_cast<std::uint8_t>(last);
+            count += static_cast<std::size_t>(std::popcount(last));
+        }
+        return count;
+    }
+
+    std::size_t
+    pack_not_equal(const std::int64_t* values, std::size_t length, std::int64_t sentinel, std::uint8_t* out) noexcept
+    {
+        const std::size_t n_bytes = length / 8;
+        std::size_t count = pack_not_equal_bytes(values, n_bytes, sentinel, out);
+        if (length % 8 != 0)
+        {
+            unsigned last = 0;
+            for (std::size_t i = 8 * n_bytes; i < length; ++i)
+            {
+                last |= static_cast<unsigned>(values[i] != sentinel) << (i % 8);
+            }
+            out[n_bytes] = static_cast<std::uint8_t>(last);
+            count += static_cast<std::size_t>(std::popcount(last));
+        }
+        return count;
+    }
+}
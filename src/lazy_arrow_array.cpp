@@ -0,0 +1,62 @@
+/**
+ * @file lazy_arrow_array.cpp
+ * @brief Implementation of the on-demand materialization of imported arrays.
+ */
+
+#include <sparrow-rockfinch/detail/lazy_arrow_array.hpp>
+
+#include <utility>
+
+#include <sparrow/arrow_interface/arrow_array.hpp>
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    lazy_arrow_array::lazy_arrow_array(ArrowArray&& array, ArrowSchema&& schema) noexcept
+        : m_array(array)
+        , m_schema(schema)
+    {
+        array.release = nullptr;
+        schema.release = nullptr;
+    }
+
+    lazy_arrow_array::~lazy_arrow_array()
+    {
+        if (m_array.release != nullptr)
+        {
+            m_array.release(&m_array);
+        }
+        if (m_schema.release != nullptr)
+        {
+            m_schema.release(&m_schema);
+        }
+    }
+
+    const ArrowArray& lazy_arrow_array::arrow_array() const
+    {
+        return m_materialized.has_value() ? *sparrow::get_arrow_array(*m_materialized) : m_array;
+    }
+
+    const ArrowSchema& lazy_arrow_array::arrow_schema() const
+    {
+        return m_materialized.has_value() ? *sparrow::get_arrow_schema(*m_materialized) : m_schema;
+    }
+
+    bool lazy_arrow_array::is_materialized() const noexcept
+    {
+        return m_materialized.has_value();
+    }
+
+    sparrow::array& lazy_arrow_array::materialize()
+    {
+        if (!m_materialized.has_value())
+        {
+            ArrowArray array = m_array;
+            ArrowSchema schema = m_schema;
+            m_array.release = nullptr;
+            m_schema.release = nullptr;
+            m_materialized.emplace(std::move(array), std::move(schema));
+        }
+        return *m_materialized;
+    }
+}
@@ -1,5 +1,20 @@
 #include <sparrow-rockfinch/pycapsule.hpp>
 
+#include <sparrow-rockfinch/arrow_device_interface.hpp>
+#include <sparrow-rockfinch/detail/lazy_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/shared_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/shared_arrow_schema.hpp>
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <sparrow/array.hpp>
 #include <sparrow/c_interface.hpp>
 #include <sparrow/arrow_interface/arrow_array_stream_proxy.hpp>
@@ -16,6 +31,8 @@ namespace sparrow::rockfinch
         constexpr const char* arrow_schema_str = "arrow_schema";
         constexpr const char* arrow_array_str = "arrow_array";
         constexpr const char* arrow_array_stream_str = "arrow_array_stream";
+        constexpr const char* arrow_device_array_str = "arrow_device_array";
+        constexpr const char* arrow_device_array_stream_str = "arrow_device_array_stream";
 
         // Capsule destructor for ArrowSchema
         void release_arrow_schema_pycapsule(PyObject* capsule)
@@ -33,7 +50,7 @@ namespace sparrow::rockfinch
             {
                 schema->release(schema);
             }
-            delete schema;
+            detail::arrow_schema_pool().release(schema);
         }
 
         // Capsule destructor for ArrowArray
@@ -52,7 +69,7 @@ namespace sparrow::rockfinch
             {
                 array->release(array);
             }
-            delete array;
+            detail::arrow_array_pool().release(array);
         }
 
         // Capsule destructor for ArrowArrayStream
@@ -73,90 +90,724 @@ namespace sparrow::rockfinch
             {
                 stream->release(stream);
             }
-            delete stream;
+            detail::arrow_array_stream_pool().release(stream);
         }
-    }
 
-    array import_array_from_capsules(PyObject* schema_capsule, PyObject* array_capsule)
-    {
-        // Get the raw pointers from the capsules
-        ArrowSchema* schema = static_cast<ArrowSchema*>(
-            PyCapsule_GetPointer(schema_capsule, arrow_schema_str)
-        );
-        if (schema == nullptr)
+        // Capsule destructor for ArrowDeviceArray
+        void release_arrow_device_array_pycapsule(PyObject* capsule)
         {
-            // Error already set by PyCapsule_GetPointer
-            return array{};
+            if (capsule == nullptr)
+            {
+                return;
+            }
+            auto* device_array = static_cast<ArrowDeviceArray*>(
+                PyCapsule_GetPointer(capsule, arrow_device_array_str)
+            );
+            if (device_array == nullptr)
+            {
+                return;
+            }
+            if (device_array->array.release != nullptr)
+            {
+                device_array->array.release(&device_array->array);
+            }
+            detail::arrow_device_array_pool().release(device_array);
         }
 
-        ArrowArray* arr = static_cast<ArrowArray*>(
-            PyCapsule_GetPointer(array_capsule, arrow_array_str)
-        );
-        if (arr == nullptr)
+        // Capsule destructor for ArrowDeviceArrayStream
+        void release_arrow_device_array_stream_pycapsule(PyObject* capsule)
         {
-            // Error already set by PyCapsule_GetPointer
-            return array{};
+            if (capsule == nullptr)
+            {
+                return;
+            }
+            auto* stream = static_cast<ArrowDeviceArrayStream*>(
+                PyCapsule_GetPointer(capsule, arrow_device_array_stream_str)
+            );
+            if (stream == nullptr)
+            {
+                return;
+            }
+            if (stream->release != nullptr)
+            {
+                stream->release(stream);
+            }
+            detail::arrow_device_array_stream_pool().release(stream);
         }
 
-        // Move the data from the capsule structures
-        ArrowSchema schema_moved = *schema;
-        ArrowArray array_moved = *arr;
+        // Wraps pooled schema and array structures into capsules.
+        // Takes ownership of both structures, releasing them on failure.
+        std::pair<PyObject*, PyObject*> make_array_capsules(ArrowSchema* schema_ptr, ArrowArray* array_ptr)
+        {
+            PyObject* schema_capsule = PyCapsule_New(
+                schema_ptr,
+                arrow_schema_str,
+                release_arrow_schema_pycapsule
+            );
 
-        // Mark as released to prevent the capsule destructors from freeing the data
-        schema->release = nullptr;
-        arr->release = nullptr;
+            if (schema_capsule == nullptr)
+            {
+                if (schema_ptr->release != nullptr)
+                {
+                    schema_ptr->release(schema_ptr);
+                }
+                detail::arrow_schema_pool().release(schema_ptr);
+                if (array_ptr->release != nullptr)
+                {
+                    array_ptr->release(array_ptr);
+                }
+                detail::arrow_array_pool().release(array_ptr);
+                return {nullptr, nullptr};
+            }
 
-        return array(std::move(array_moved), std::move(schema_moved));
+            PyObject* array_capsule = PyCapsule_New(
+                array_ptr,
+                arrow_array_str,
+                release_arrow_array_pycapsule
+            );
+
+            if (array_capsule == nullptr)
+            {
+                Py_DECREF(schema_capsule);
+                if (array_ptr->release != nullptr)
+                {
+                    array_ptr->release(array_ptr);
+                }
+                detail::arrow_array_pool().release(array_ptr);
+                return {nullptr, nullptr};
+            }
+
+            return {schema_capsule, array_capsule};
+        }
+
+        // Same as make_array_capsules for a CPU ArrowDeviceArray.
+        std::pair<PyObject*, PyObject*>
+        make_device_array_capsules(ArrowSchema* schema_ptr, ArrowDeviceArray* device_array_ptr)
+        {
+            device_array_ptr->device_id = arrow_cpu_device_id;
+            device_array_ptr->device_type = ARROW_DEVICE_CPU;
+
+            PyObject* schema_capsule = PyCapsule_New(
+                schema_ptr,
+                arrow_schema_str,
+                release_arrow_schema_pycapsule
+            );
+
+            if (schema_capsule == nullptr)
+            {
+                if (schema_ptr->release != nullptr)
+                {
+                    schema_ptr->release(schema_ptr);
+                }
+                detail::arrow_schema_pool().release(schema_ptr);
+                if (device_array_ptr->array.release != nullptr)
+                {
+                    device_array_ptr->array.release(&device_array_ptr->array);
+                }
+                detail::arrow_device_array_pool().release(device_array_ptr);
+                return {nullptr, nullptr};
+            }
+
+            PyObject* device_array_capsule = PyCapsule_New(
+                device_array_ptr,
+                arrow_device_array_str,
+                release_arrow_device_array_pycapsule
+            );
+
+            if (device_array_capsule == nullptr)
+            {
+                Py_DECREF(schema_capsule);
+                if (device_array_ptr->array.release != nullptr)
+                {
+                    device_array_ptr->array.release(&device_array_ptr->array);
+                }
+                detail::arrow_device_array_pool().release(device_array_ptr);
+                return {nullptr, nullptr};
+            }
+
+            return {schema_capsule, device_array_capsule};
+        }
+
+        // Raises ValueError if `mode` asks for validation and the structures are invalid
+        bool check_imported_structures(const ArrowArray& array, const ArrowSchema& schema, validation_mode mode)
+        {
+            if (mode == validation_mode::trusted)
+            {
+                return true;
+            }
+            const std::optional<std::string> error = validate_arrow_array(array, schema);
+            if (error.has_value())
+            {
+                PyErr_Format(PyExc_ValueError, "Invalid Arrow array: %s", error->c_str());
+                return false;
+            }
+            return true;
+        }
+
+        // Moves the structures out of schema and array capsules, leaving the capsules
+        // released. Returns false with a Python error set if a capsule is invalid.
+        bool take_array_structures(
+            PyObject* schema_capsule,
+            PyObject* array_capsule,
+            validation_mode mode,
+            ArrowSchema& schema_out,
+            ArrowArray& array_out
+        )
+        {
+            auto* schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(schema_capsule, arrow_schema_str));
+            if (schema == nullptr)
+            {
+                // Error already set by PyCapsule_GetPointer
+                return false;
+            }
+
+            auto* arr = static_cast<ArrowArray*>(PyCapsule_GetPointer(array_capsule, arrow_array_str));
+            if (arr == nullptr)
+            {
+                // Error already set by PyCapsule_GetPointer
+                return false;
+            }
+            if (!check_imported_structures(*arr, *schema, mode))
+            {
+                return false;
+            }
+
+            // Move the data from the capsule structures
+            schema_out = *schema;
+            array_out = *arr;
+
+            // Mark as released to prevent the capsule destructors from freeing the data
+            schema->release = nullptr;
+            arr->release = nullptr;
+            return true;
+        }
+
+        // Same as take_array_structures for a CPU ArrowDeviceArray capsule.
+        bool take_device_array_structures(
+            PyObject* schema_capsule,
+            PyObject* device_array_capsule,
+            validation_mode mode,
+            ArrowSchema& schema_out,
+            ArrowArray& array_out
+        )
+        {
+            auto* schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(schema_capsule, arrow_schema_str));
+            if (schema == nullptr)
+            {
+                // Error already set by PyCapsule_GetPointer
+                return false;
+            }
+
+            auto* device_array = static_cast<ArrowDeviceArray*>(
+                PyCapsule_GetPointer(device_array_capsule, arrow_device_array_str)
+            );
+            if (device_array == nullptr)
+            {
+                // Error already set by PyCapsule_GetPointer
+                return false;
+            }
+            if (device_array->device_type != ARROW_DEVICE_CPU)
+            {
+                PyErr_Format(
+                    PyExc_ValueError,
+                    "Only CPU device arrays are supported, got device type %d",
+                    static_cast<int>(device_array->device_type)
+                );
+                return false;
+            }
+            if (!check_imported_structures(device_array->array, *schema, mode))
+            {
+                return false;
+            }
+
+            // Move the data from the capsule structures
+            schema_out = *schema;
+            array_out = device_array->array;
+
+            // Mark as released to prevent the capsule destructors from freeing the data
+            schema->release = nullptr;
+            device_array->array.release = nullptr;
+            return true;
+        }
+
+        // ArrowDeviceArrayStream exposing a CPU ArrowArrayStream
+        struct cpu_device_stream_private_data
+        {
+            ArrowArrayStream stream;
+        };
+
+        ArrowArrayStream& cpu_device_stream_source(ArrowDeviceArrayStream* self)
+        {
+            return static_cast<cpu_device_stream_private_data*>(self->private_data)->stream;
+        }
+
+        int cpu_device_stream_get_schema(ArrowDeviceArrayStream* self, ArrowSchema* out)
+        {
+            ArrowArrayStream& source = cpu_device_stream_source(self);
+            return source.get_schema(&source, out);
+        }
+
+        int cpu_device_stream_get_next(ArrowDeviceArrayStream* self, ArrowDeviceArray* out)
+        {
+            ArrowArrayStream& source = cpu_device_stream_source(self);
+            *out = ArrowDeviceArray{};
+            out->device_id = arrow_cpu_device_id;
+            out->device_type = ARROW_DEVICE_CPU;
+            return source.get_next(&source, &out->array);
+        }
+
+        const char* cpu_device_stream_get_last_error(ArrowDeviceArrayStream* self)
+        {
+            ArrowArrayStream& source = cpu_device_stream_source(self);
+            return source.get_last_error(&source);
+        }
+
+        void cpu_device_stream_release(ArrowDeviceArrayStream* self)
+        {
+            auto* private_data = static_cast<cpu_device_stream_private_data*>(self->private_data);
+            if (private_data->stream.release != nullptr)
+            {
+                private_data->stream.release(&private_data->stream);
+            }
+            delete private_data;
+            self->private_data = nullptr;
+            self->release = nullptr;
+        }
+
+        // ArrowArrayStream exposing a CPU ArrowDeviceArrayStream
+        struct device_stream_adapter_private_data
+        {
+            ArrowDeviceArrayStream stream;
+            const char* last_error = nullptr;
+        };
+
+        ArrowDeviceArrayStream& device_stream_source(ArrowArrayStream* self)
+        {
+            return static_cast<device_stream_adapter_private_data*>(self->private_data)->stream;
+        }
+
+        int device_stream_adapter_get_schema(ArrowArrayStream* self, ArrowSchema* out)
+        {
+            ArrowDeviceArrayStream& source = device_stream_source(self);
+            return source.get_schema(&source, out);
+        }
+
+        int device_stream_adapter_get_next(ArrowArrayStream* self, ArrowArray* out)
+        {
+            auto* private_data = static_cast<device_stream_adapter_private_data*>(self->private_data);
+            ArrowDeviceArray device_array{};
+            const int code = private_data->stream.get_next(&private_data->stream, &device_array);
+            if (code != 0)
+            {
+                private_data->last_error = nullptr;
+                return code;
+            }
+            if (device_array.array.release != nullptr && device_array.device_type != ARROW_DEVICE_CPU)
+            {
+                device_array.array.release(&device_array.array);
+                private_data->last_error = "sparrow-rockfinch only supports CPU device arrays";
+                return EINVAL;
+            }
+            *out = device_array.array;
+            return 0;
+        }
+
+        const char* device_stream_adapter_get_last_error(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<device_stream_adapter_private_data*>(self->private_data);
+            if (private_data->last_error != nullptr)
+            {
+                return private_data->last_error;
+            }
+            return private_data->stream.get_last_error(&private_data->stream);
+        }
+
+        void device_stream_adapter_release(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<device_stream_adapter_private_data*>(self->private_data);
+            if (private_data->stream.release != nullptr)
+            {
+                private_data->stream.release(&private_data->stream);
+            }
+            delete private_data;
+            self->private_data = nullptr;
+            self->release = nullptr;
+        }
+
+        // ArrowArrayStream checking every batch of another stream with validate_arrow_array
+        struct validating_stream_private_data
+        {
+            ArrowArrayStream stream;
+            ArrowSchema schema{};
+            std::string last_error;
+        };
+
+        int validating_stream_get_schema(ArrowArrayStream* self, ArrowSchema* out)
+        {
+            ArrowArrayStream& source = static_cast<validating_stream_private_data*>(self->private_data)->stream;
+            return source.get_schema(&source, out);
+        }
+
+        int validating_stream_get_next(ArrowArrayStream* self, ArrowArray* out)
+        {
+            auto* private_data = static_cast<validating_stream_private_data*>(self->private_data);
+            ArrowArrayStream& source = private_data->stream;
+            private_data->last_error.clear();
+            if (private_data->schema.release == nullptr)
+            {
+                const int code = source.get_schema(&source, &private_data->schema);
+                if (code != 0)
+                {
+                    return code;
+                }
+            }
+
+            const int code = source.get_next(&source, out);
+            if (code != 0 || out->release == nullptr)
+            {
+                return code;
+            }
+            std::optional<std::string> error = validate_arrow_array(*out, private_data->schema);
+            if (error.has_value())
+            {
+                out->release(out);
+                private_data->last_error = "Invalid Arrow array: " + *error;
+                return EINVAL;
+            }
+            return 0;
+        }
+
+        const char* validating_stream_get_last_error(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<validating_stream_private_data*>(self->private_data);
+            if (!private_data->last_error.empty())
+            {
+                return private_data->last_error.c_str();
+            }
+            return private_data->stream.get_last_error(&private_data->stream);
+        }
+
+        void validating_stream_release(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<validating_stream_private_data*>(self->private_data);
+            if (private_data->schema.release != nullptr)
+            {
+                private_data->schema.release(&private_data->schema);
+            }
+            if (private_data->stream.release != nullptr)
+            {
+                private_data->stream.release(&private_data->stream);
+            }
+            delete private_data;
+            self->private_data = nullptr;
+            self->release = nullptr;
+        }
+
+        // Size in bytes of Arrow C metadata: a pair count, then length-prefixed keys and values
+        std::size_t metadata_size(const char* metadata) noexcept
+        {
+            if (metadata == nullptr)
+            {
+                return 0;
+            }
+            std::int32_t n_pairs = 0;
+            std::memcpy(&n_pairs, metadata, sizeof(n_pairs));
+            std::size_t size = sizeof(n_pairs);
+            for (std::int32_t i = 0; i < 2 * n_pairs; ++i)
+            {
+                std::int32_t length = 0;
+                std::memcpy(&length, metadata + size, sizeof(length));
+                size += sizeof(length) + static_cast<std::size_t>(length);
+            }
+            return size;
+        }
+
+        bool same_string(const char* lhs, const char* rhs) noexcept
+        {
+            return lhs == rhs || (lhs != nullptr && rhs != nullptr && std::strcmp(lhs, rhs) == 0);
+        }
+
+        // Whether two schemas are equal: formats, names, metadata and flags, recursively
+        bool same_schema(const ArrowSchema& lhs, const ArrowSchema& rhs) noexcept
+        {
+            if (!same_string(lhs.format, rhs.format) || !same_string(lhs.name, rhs.name) || lhs.flags != rhs.flags
+                || lhs.n_children != rhs.n_children)
+            {
+                return false;
+            }
+            const std::size_t size = metadata_size(lhs.metadata);
+            if (size != metadata_size(rhs.metadata) || (size != 0 && std::memcmp(lhs.metadata, rhs.metadata, size) != 0))
+            {
+                return false;
+            }
+            for (std::int64_t i = 0; i < lhs.n_children; ++i)
+            {
+                if (!same_schema(*lhs.children[i], *rhs.children[i]))
+                {
+                    return false;
+                }
+            }
+            if ((lhs.dictionary == nullptr) != (rhs.dictionary == nullptr))
+            {
+                return false;
+            }
+            return lhs.dictionary == nullptr || same_schema(*lhs.dictionary, *rhs.dictionary);
+        }
+
+        void release_and_delete_arrow_array(ArrowArray* array)
+        {
+            if (array->release != nullptr)
+            {
+                array->release(array);
+            }
+            delete array;
+        }
+
+        // Moves `source` into a proxy, behind a validating adapter if requested
+        arrow_array_stream_proxy make_stream_proxy(ArrowArrayStream&& source, validation_mode mode)
+        {
+            if (mode == validation_mode::trusted)
+            {
+                return arrow_array_stream_proxy(std::move(source));
+            }
+
+            auto* private_data = new validating_stream_private_data{source, ArrowSchema{}, std::string()};
+            source.release = nullptr;
+
+            ArrowArrayStream stream{};
+            stream.get_schema = &validating_stream_get_schema;
+            stream.get_next = &validating_stream_get_next;
+            stream.get_last_error = &validating_stream_get_last_error;
+            stream.release = &validating_stream_release;
+            stream.private_data = private_data;
+            return arrow_array_stream_proxy(std::move(stream));
+        }
     }
 
-    std::pair<PyObject*, PyObject*> export_array_to_capsules(array& arr)
+    array import_array_from_capsules(PyObject* schema_capsule, PyObject* array_capsule, validation_mode mode)
     {
-        // Extract both schema and array from the sparrow array (moves ownership)
-        auto [arrow_array, arrow_schema] = extract_arrow_structures(std::move(arr));
-
-        // Allocate heap copies for the PyCapsules
-        auto* schema_ptr = new ArrowSchema(arrow_schema);
-        auto* array_ptr = new ArrowArray(arrow_array);
+        ArrowSchema schema_moved{};
+        ArrowArray array_moved{};
+        if (!take_array_structures(schema_capsule, array_capsule, mode, schema_moved, array_moved))
+        {
+            return array{};
+        }
+        return array(std::move(array_moved), std::move(schema_moved));
+    }
 
-        PyObject* schema_capsule = PyCapsule_New(
-            schema_ptr,
-            arrow_schema_str,
-            release_arrow_schema_pycapsule
-        );
+    std::shared_ptr<detail::lazy_arrow_array>
+    import_lazy_array_from_capsules(PyObject* schema_capsule, PyObject* array_capsule, validation_mode mode)
+    {
+        ArrowSchema schema_moved{};
+        ArrowArray array_moved{};
+        if (!take_array_structures(schema_capsule, array_capsule, mode, schema_moved, array_moved))
+        {
+            return nullptr;
+        }
+        return std::make_shared<detail::lazy_arrow_array>(std::move(array_moved), std::move(schema_moved));
+    }
 
-        if (schema_capsule == nullptr)
+    std::optional<std::vector<array>>
+    import_arrays_from_capsules(std::span<const std::pair<PyObject*, PyObject*>> capsule_pairs)
+    {
+        // Validation pass: nothing is consumed until the whole batch is known to be valid
+        std::vector<std::pair<ArrowSchema*, ArrowArray*>> structures;
+        structures.reserve(capsule_pairs.size());
+        std::unordered_set<PyObject*> seen_schema_capsules;
+        std::unordered_set<PyObject*> seen_array_capsules;
+        for (std::size_t i = 0; i < capsule_pairs.size(); ++i)
         {
-            if (schema_ptr->release != nullptr)
+            const auto& [schema_capsule, array_capsule] = capsule_pairs[i];
+            auto* schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(schema_capsule, arrow_schema_str));
+            if (schema == nullptr)
             {
-                schema_ptr->release(schema_ptr);
+                // Error already set by PyCapsule_GetPointer
+                return std::nullopt;
+            }
+            auto* arr = static_cast<ArrowArray*>(PyCapsule_GetPointer(array_capsule, arrow_array_str));
+            if (arr == nullptr)
+            {
+                // Error already set by PyCapsule_GetPointer
+                return std::nullopt;
             }
-            delete schema_ptr;
-            if (array_ptr->release != nullptr)
+            if (seen_schema_capsules.insert(schema_capsule).second && schema->release == nullptr)
             {
-                array_ptr->release(array_ptr);
+                PyErr_Format(PyExc_ValueError, "ArrowSchema of pair %zu has already been consumed", i);
+                return std::nullopt;
             }
-            delete array_ptr;
-            return {nullptr, nullptr};
+            if (!seen_array_capsules.insert(array_capsule).second)
+            {
+                PyErr_Format(PyExc_ValueError, "ArrowArray capsule of pair %zu appears more than once", i);
+                return std::nullopt;
+            }
+            if (arr->release == nullptr)
+            {
+                PyErr_Format(PyExc_ValueError, "ArrowArray of pair %zu has already been consumed", i);
+                return std::nullopt;
+            }
+            structures.emplace_back(schema, arr);
         }
 
-        PyObject* array_capsule = PyCapsule_New(
-            array_ptr,
-            arrow_array_str,
-            release_arrow_array_pycapsule
-        );
+        // Build pass: each distinct schema is copied once into a shared schema that
+        // every array using it exports. The arrays are views over the capsule
+        // buffers, owned by holders that stay empty until the commit pass, so that
+        // dropping the arrays on failure leaves every capsule untouched.
+        using schema_handle = std::shared_ptr<const detail::shared_arrow_schema>;
+        std::unordered_map<PyObject*, schema_handle> schemas_by_capsule;
+        std::unordered_map<std::string_view, std::vector<schema_handle>> schemas_by_format;
+        std::vector<std::shared_ptr<ArrowArray>> holders;
+        std::vector<array> result;
+        try
+        {
+            holders.reserve(capsule_pairs.size());
+            result.reserve(capsule_pairs.size());
+            for (std::size_t i = 0; i < capsule_pairs.size(); ++i)
+            {
+                const auto [schema, arr] = structures[i];
+                schema_handle& shared_schema = schemas_by_capsule[capsule_pairs[i].first];
+                if (shared_schema == nullptr)
+                {
+                    std::vector<schema_handle>& candidates = schemas_by_format[schema->format];
+                    const auto it = std::find_if(
+                        candidates.begin(),
+                        candidates.end(),
+                        [schema](const schema_handle& candidate)
+                        {
+                            return same_schema(candidate->schema(), *schema);
+                        }
+                    );
+                    if (it != candidates.end())
+                    {
+                        shared_schema = *it;
+                    }
+                    else
+                    {
+                        shared_schema = detail::shared_arrow_schema::make(*schema);
+                        candidates.push_back(shared_schema);
+                    }
+                }
 
-        if (array_capsule == nullptr)
+                holders.push_back(std::shared_ptr<ArrowArray>(new ArrowArray{}, &release_and_delete_arrow_array));
+                ArrowArray array_view{};
+                detail::make_shared_arrow_array(*arr, holders.back(), array_view);
+                ArrowSchema schema_view{};
+                try
+                {
+                    shared_schema->export_to(schema_view);
+                    result.emplace_back(std::move(array_view), std::move(schema_view));
+                }
+                catch (...)
+                {
+                    // Whatever the array did not take over is released here
+                    if (array_view.release != nullptr)
+                    {
+                        array_view.release(&array_view);
+                    }
+                    if (schema_view.release != nullptr)
+                    {
+                        schema_view.release(&schema_view);
+                    }
+                    throw;
+                }
+            }
+        }
+        catch (const std::exception& e)
         {
-            Py_DECREF(schema_capsule);
-            if (array_ptr->release != nullptr)
+            PyErr_Format(PyExc_RuntimeError, "Failed to import the arrays: %s", e.what());
+            return std::nullopt;
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to import the arrays");
+            return std::nullopt;
+        }
+
+        // Commit pass (cannot fail): the holders take over the capsule arrays, and
+        // the schemas, copied into the shared schemas, are released
+        for (std::size_t i = 0; i < structures.size(); ++i)
+        {
+            auto [schema, arr] = structures[i];
+            *holders[i] = *arr;
+            arr->release = nullptr;
+            if (schema->release != nullptr)
             {
-                array_ptr->release(array_ptr);
+                schema->release(schema);
+                schema->release = nullptr;
             }
-            delete array_ptr;
-            return {nullptr, nullptr};
         }
+        return result;
+    }
+
+    std::pair<PyObject*, PyObject*> export_array_to_capsules(array& arr)
+    {
+        // Extract both schema and array from the sparrow array (moves ownership)
+        auto [arrow_array, arrow_schema] = extract_arrow_structures(std::move(arr));
+
+        // Allocate pooled copies for the PyCapsules
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
+        *schema_ptr = arrow_schema;
+        auto* array_ptr = detail::arrow_array_pool().acquire();
+        *array_ptr = arrow_array;
 
-        return {schema_capsule, array_capsule};
+        return make_array_capsules(schema_ptr, array_ptr);
+    }
+
+    std::pair<PyObject*, PyObject*> export_shared_array_to_capsules(const std::shared_ptr<const array>& arr)
+    {
+        const auto schema = detail::shared_arrow_schema::make(*sparrow::get_arrow_schema(*arr));
+        return export_shared_array_to_capsules(arr, *schema);
+    }
+
+    std::pair<PyObject*, PyObject*> export_shared_array_to_capsules(
+        const std::shared_ptr<const array>& arr,
+        const detail::shared_arrow_schema& schema
+    )
+    {
+        return export_shared_array_to_capsules(*sparrow::get_arrow_array(*arr), arr, schema);
+    }
+
+    std::pair<PyObject*, PyObject*> export_shared_array_to_capsules(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        const detail::shared_arrow_schema& schema
+    )
+    {
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
+        schema.export_to(*schema_ptr);
+
+        // The exported array borrows the buffers and keeps `owner` alive
+        auto* array_ptr = detail::arrow_array_pool().acquire();
+        try
+        {
+            detail::make_shared_arrow_array(source, owner, *array_ptr);
+        }
+        catch (...)
+        {
+            schema_ptr->release(schema_ptr);
+            detail::arrow_schema_pool().release(schema_ptr);
+            detail::arrow_array_pool().release(array_ptr);
+            throw;
+        }
+
+        return make_array_capsules(schema_ptr, array_ptr);
+    }
+
+    const ArrowSchema* get_schema_from_capsule(PyObject* schema_capsule)
+    {
+        const auto* schema = static_cast<const ArrowSchema*>(
+            PyCapsule_GetPointer(schema_capsule, arrow_schema_str)
+        );
+        if (schema == nullptr)
+        {
+            // Error already set by PyCapsule_GetPointer
+            return nullptr;
+        }
+        if (schema->release == nullptr)
+        {
+            PyErr_SetString(PyExc_ValueError, "ArrowSchema has already been released");
+            return nullptr;
+        }
+        return schema;
     }
 
     PyObject* export_schema_to_capsule(const array& arr)
@@ -165,7 +816,7 @@ namespace sparrow::rockfinch
         const ArrowSchema* schema = sparrow::get_arrow_schema(arr);
         
         // Allocate and copy the schema
-        auto* schema_ptr = new ArrowSchema();
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
         sparrow::copy_schema(*schema, *schema_ptr);
 
         PyObject* capsule = PyCapsule_New(
@@ -180,7 +831,28 @@ namespace sparrow::rockfinch
             {
                 schema_ptr->release(schema_ptr);
             }
-            delete schema_ptr;
+            detail::arrow_schema_pool().release(schema_ptr);
+            return nullptr;
+        }
+
+        return capsule;
+    }
+
+    PyObject* export_shared_schema_to_capsule(const detail::shared_arrow_schema& schema)
+    {
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
+        schema.export_to(*schema_ptr);
+
+        PyObject* capsule = PyCapsule_New(
+            schema_ptr,
+            arrow_schema_str,
+            release_arrow_schema_pycapsule
+        );
+
+        if (capsule == nullptr)
+        {
+            schema_ptr->release(schema_ptr);
+            detail::arrow_schema_pool().release(schema_ptr);
             return nullptr;
         }
 
@@ -197,8 +869,9 @@ namespace sparrow::rockfinch
             return nullptr;
         }
 
-        // Create heap copy for capsule ownership
-        auto* heap_stream = new ArrowArrayStream(*stream_ptr);
+        // Create pooled copy for capsule ownership
+        auto* heap_stream = detail::arrow_array_stream_pool().acquire();
+        *heap_stream = *stream_ptr;
         // Clear the source to prevent double-release
         stream_ptr->release = nullptr;
 
@@ -214,14 +887,162 @@ namespace sparrow::rockfinch
             {
                 heap_stream->release(heap_stream);
             }
-            delete heap_stream;
+            detail::arrow_array_stream_pool().release(heap_stream);
             return nullptr;
         }
 
         return capsule;
     }
 
-    arrow_array_stream_proxy import_stream_proxy_from_capsule(PyObject* stream_capsule)
+    array import_array_from_device_capsules(
+        PyObject* schema_capsule,
+        PyObject* device_array_capsule,
+        validation_mode mode
+    )
+    {
+        ArrowSchema schema_moved{};
+        ArrowArray array_moved{};
+        if (!take_device_array_structures(schema_capsule, device_array_capsule, mode, schema_moved, array_moved))
+        {
+            return array{};
+        }
+        return array(std::move(array_moved), std::move(schema_moved));
+    }
+
+    std::shared_ptr<detail::lazy_arrow_array> import_lazy_array_from_device_capsules(
+        PyObject* schema_capsule,
+        PyObject* device_array_capsule,
+        validation_mode mode
+    )
+    {
+        ArrowSchema schema_moved{};
+        ArrowArray array_moved{};
+        if (!take_device_array_structures(schema_capsule, device_array_capsule, mode, schema_moved, array_moved))
+        {
+            return nullptr;
+        }
+        return std::make_shared<detail::lazy_arrow_array>(std::move(array_moved), std::move(schema_moved));
+    }
+
+    std::pair<PyObject*, PyObject*> export_array_to_device_capsules(array& arr)
+    {
+        // Extract both schema and array from the sparrow array (moves ownership)
+        auto [arrow_array, arrow_schema] = extract_arrow_structures(std::move(arr));
+
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
+        *schema_ptr = arrow_schema;
+        auto* device_array_ptr = detail::arrow_device_array_pool().acquire();
+        device_array_ptr->array = arrow_array;
+
+        return make_device_array_capsules(schema_ptr, device_array_ptr);
+    }
+
+    std::pair<PyObject*, PyObject*> export_shared_array_to_device_capsules(
+        const std::shared_ptr<const array>& arr,
+        const detail::shared_arrow_schema& schema
+    )
+    {
+        return export_shared_array_to_device_capsules(*sparrow::get_arrow_array(*arr), arr, schema);
+    }
+
+    std::pair<PyObject*, PyObject*> export_shared_array_to_device_capsules(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        const detail::shared_arrow_schema& schema
+    )
+    {
+        auto* schema_ptr = detail::arrow_schema_pool().acquire();
+        schema.export_to(*schema_ptr);
+
+        // The exported array borrows the buffers and keeps `owner` alive
+        auto* device_array_ptr = detail::arrow_device_array_pool().acquire();
+        try
+        {
+            detail::make_shared_arrow_array(source, owner, device_array_ptr->array);
+        }
+        catch (...)
+        {
+            schema_ptr->release(schema_ptr);
+            detail::arrow_schema_pool().release(schema_ptr);
+            detail::arrow_device_array_pool().release(device_array_ptr);
+            throw;
+        }
+
+        return make_device_array_capsules(schema_ptr, device_array_ptr);
+    }
+
+    PyObject* export_stream_proxy_to_device_capsule(arrow_array_stream_proxy& proxy)
+    {
+        ArrowArrayStream* stream_ptr = proxy.export_stream();
+        if (stream_ptr == nullptr)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to export stream from proxy");
+            return nullptr;
+        }
+
+        // The device stream takes over the exported stream
+        auto* private_data = new cpu_device_stream_private_data{*stream_ptr};
+        stream_ptr->release = nullptr;
+
+        auto* device_stream = detail::arrow_device_array_stream_pool().acquire();
+        device_stream->device_type = ARROW_DEVICE_CPU;
+        device_stream->get_schema = &cpu_device_stream_get_schema;
+        device_stream->get_next = &cpu_device_stream_get_next;
+        device_stream->get_last_error = &cpu_device_stream_get_last_error;
+        device_stream->release = &cpu_device_stream_release;
+        device_stream->private_data = private_data;
+
+        PyObject* capsule = PyCapsule_New(
+            device_stream,
+            arrow_device_array_stream_str,
+            release_arrow_device_array_stream_pycapsule
+        );
+
+        if (capsule == nullptr)
+        {
+            device_stream->release(device_stream);
+            detail::arrow_device_array_stream_pool().release(device_stream);
+            return nullptr;
+        }
+
+        return capsule;
+    }
+
+    arrow_array_stream_proxy import_stream_proxy_from_device_capsule(PyObject* stream_capsule, validation_mode mode)
+    {
+        auto* device_stream = static_cast<ArrowDeviceArrayStream*>(
+            PyCapsule_GetPointer(stream_capsule, arrow_device_array_stream_str)
+        );
+        if (device_stream == nullptr)
+        {
+            // Error already set by PyCapsule_GetPointer
+            return arrow_array_stream_proxy();
+        }
+        if (device_stream->device_type != ARROW_DEVICE_CPU)
+        {
+            PyErr_Format(
+                PyExc_ValueError,
+                "Only CPU device streams are supported, got device type %d",
+                static_cast<int>(device_stream->device_type)
+            );
+            return arrow_array_stream_proxy();
+        }
+
+        // Move the device stream behind a plain ArrowArrayStream adapter
+        auto* private_data = new device_stream_adapter_private_data{*device_stream};
+        device_stream->release = nullptr;
+
+        ArrowArrayStream stream{};
+        stream.get_schema = &device_stream_adapter_get_schema;
+        stream.get_next = &device_stream_adapter_get_next;
+        stream.get_last_error = &device_stream_adapter_get_last_error;
+        stream.release = &device_stream_adapter_release;
+        stream.private_data = private_data;
+
+        return make_stream_proxy(std::move(stream), mode);
+    }
+
+    arrow_array_stream_proxy import_stream_proxy_from_capsule(PyObject* stream_capsule, validation_mode mode)
     {
         // Get the stream pointer from the capsule
         auto* stream = static_cast<ArrowArrayStream*>(
@@ -238,6 +1059,6 @@ namespace sparrow::rockfinch
         // Mark the capsule's stream as consumed
         stream->release = nullptr;
 
-        return arrow_array_stream_proxy(std::move(stream_copy));
+        return make_stream_proxy(std::move(stream_copy), mode);
     }
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+/**
+ * @file shared_arrow_array.cpp
+ * @brief Implementation of ArrowArray views sharing buffer ownership.
+ */
+
+#include <sparrow-rockfinch/detail/shared_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include <sparrow/c_interface.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        void release_shared_arrow_array_node(ArrowArray*& node)
+        {
+            if (node == nullptr)
+            {
+                return;
+            }
+            if (node->release != nullptr)
+            {
+                node->release(node);
+            }
+            arrow_array_pool().release(node);
+            node = nullptr;
+        }
+    }
+
+    void aligned_buffer_deleter::operator()(std::byte* ptr) const noexcept
+    {
+        ::operator delete[](ptr, std::align_val_t{arrow_buffer_alignment});
+    }
+
+    aligned_buffer make_aligned_buffer(std::size_t size)
+    {
+        // Always allocate at least one block so that empty buffers get a valid, aligned pointer
+        const std::size_t blocks = size == 0 ? 1 : (size + arrow_buffer_alignment - 1) / arrow_buffer_alignment;
+        const std::size_t padded = blocks * arrow_buffer_alignment;
+        auto* ptr = static_cast<std::byte*>(::operator new[](padded, std::align_val_t{arrow_buffer_alignment}));
+        std::memset(ptr, 0, padded);
+        return aligned_buffer(ptr);
+    }
+
+    void release_shared_arrow_array(ArrowArray* array)
+    {
+        if (array == nullptr || array->release == nullptr)
+        {
+            return;
+        }
+
+        auto* private_data = static_cast<shared_arrow_array_private_data*>(array->private_data);
+        if (private_data != nullptr)
+        {
+            for (ArrowArray*& child : private_data->children)
+            {
+                release_shared_arrow_array_node(child);
+            }
+            release_shared_arrow_array_node(private_data->dictionary);
+            delete private_data;
+        }
+
+        array->length = 0;
+        array->null_count = 0;
+        array->offset = 0;
+        array->n_buffers = 0;
+        array->n_children = 0;
+        array->buffers = nullptr;
+        array->children = nullptr;
+        array->dictionary = nullptr;
+        array->private_data = nullptr;
+        array->release = nullptr;
+    }
+
+    void make_shared_arrow_array(
+        const ArrowArray& source,
+        const std::shared_ptr<const void>& owner,
+        ArrowArray& target
+    )
+    {
+        auto private_data = std::make_unique<shared_arrow_array_private_data>();
+        private_data->owner = owner;
+        private_data->buffers.assign(source.buffers, source.buffers + source.n_buffers);
+
+        target = ArrowArray{};
+        target.length = source.length;
+        target.null_count = source.null_count;
+        target.offset = source.offset;
+        target.n_buffers = source.n_buffers;
+        target.n_children = source.n_children;
+        target.buffers = private_data->buffers.data();
+        target.private_data = private_data.get();
+        target.release = &release_shared_arrow_array;
+
+        // From now on, the release callback cleans up partially built children.
+        private_data.release();
+        auto* data = static_cast<shared_arrow_array_private_data*>(target.private_data);
+        try
+        {
+            data->children.reserve(static_cast<std::size_t>(source.n_children));
+            for (std::int64_t i = 0; i < source.n_children; ++i)
+            {
+                data->children.push_back(arrow_array_pool().acquire());
+                make_shared_arrow_array(*source.children[i], owner, *data->children.back());
+            }
+            if (source.dictionary != nullptr)
+            {
+                data->dictionary = arrow_array_pool().acquire();
+                make_shared_arrow_array(*source.dictionary, owner, *data->dictionary);
+            }
+        }
+        catch (...)
+        {
+            target.release(&target);
+            throw;
+        }
+        target.children = data->children.empty() ? nullptr : data->children.data();
+        target.dictionary = data->dictionary;
+    }
+}
@@ -0,0 +1,189 @@
+/**
+ * @file shared_arrow_schema.cpp
+ * @brief Implementation of the reference-counted ArrowSchema cache.
+ */
+
+#include <sparrow-rockfinch/detail/shared_arrow_schema.hpp>
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+#include <sparrow/c_interface.hpp>
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        // Private data of an exported node that has children or a dictionary.
+        // Flat nodes point directly to the shared_arrow_schema instead.
+        struct nested_schema_node
+        {
+            const shared_arrow_schema* owner = nullptr;
+            std::vector<ArrowSchema*> children;
+            ArrowSchema* dictionary = nullptr;
+        };
+
+        void release_exported_child(ArrowSchema*& child)
+        {
+            if (child == nullptr)
+            {
+                return;
+            }
+            if (child->release != nullptr)
+            {
+                child->release(child);
+            }
+            arrow_schema_pool().release(child);
+            child = nullptr;
+        }
+
+        void reset_released_schema(ArrowSchema* schema)
+        {
+            schema->format = nullptr;
+            schema->name = nullptr;
+            schema->metadata = nullptr;
+            schema->flags = 0;
+            schema->n_children = 0;
+            schema->children = nullptr;
+            schema->dictionary = nullptr;
+            schema->private_data = nullptr;
+            schema->release = nullptr;
+        }
+    }
+
+    shared_arrow_schema::shared_arrow_schema()
+        : m_schema(std::make_unique<ArrowSchema>())
+    {
+    }
+
+    shared_arrow_schema::~shared_arrow_schema()
+    {
+        if (m_schema->release != nullptr)
+        {
+            m_schema->release(m_schema.get());
+        }
+    }
+
+    std::shared_ptr<const shared_arrow_schema> shared_arrow_schema::make(const ArrowSchema& source)
+    {
+        auto* raw = new shared_arrow_schema();
+        try
+        {
+            sparrow::copy_schema(source, *raw->m_schema);
+        }
+        catch (...)
+        {
+            delete raw;
+            throw;
+        }
+        return {
+            raw,
+            [](const shared_arrow_schema* ptr)
+            {
+                ptr->release_reference();
+            }
+        };
+    }
+
+    void shared_arrow_schema::export_to(ArrowSchema& target) const
+    {
+        export_node(*m_schema, target);
+    }
+
+    const ArrowSchema& shared_arrow_schema::schema() const noexcept
+    {
+        return *m_schema;
+    }
+
+    void shared_arrow_schema::export_node(const ArrowSchema& node, ArrowSchema& target) const
+    {
+        target.format = node.format;
+        target.name = node.name;
+        target.metadata = node.metadata;
+        target.flags = node.flags;
+        target.n_children = node.n_children;
+        target.children = nullptr;
+        target.dictionary = nullptr;
+
+        if (node.n_children == 0 && node.dictionary == nullptr)
+        {
+            retain();
+            target.private_data = const_cast<shared_arrow_schema*>(this);
+            target.release = &release_flat_node;
+            return;
+        }
+
+        auto private_data = std::make_unique<nested_schema_node>();
+        private_data->owner = this;
+        private_data->children.reserve(static_cast<std::size_t>(node.n_children));
+        retain();
+        target.private_data = private_data.release();
+        target.release = &release_nested_node;
+
+        // From now on, the release callback cleans up partially exported children.
+        auto* data = static_cast<nested_schema_node*>(target.private_data);
+        try
+        {
+            for (std::int64_t i = 0; i < node.n_children; ++i)
+            {
+                data->children.push_back(arrow_schema_pool().acquire());
+                export_node(*node.children[i], *data->children.back());
+            }
+            if (node.dictionary != nullptr)
+            {
+                data->dictionary = arrow_schema_pool().acquire();
+                export_node(*node.dictionary, *data->dictionary);
+            }
+        }
+        catch (...)
+        {
+            target.release(&target);
+            throw;
+        }
+        target.children = data->children.empty() ? nullptr : data->children.data();
+        target.dictionary = data->dictionary;
+    }
+
+    void shared_arrow_schema::retain() const noexcept
+    {
+        m_ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void shared_arrow_schema::release_reference() const noexcept
+    {
+        if (m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+
+    void shared_arrow_schema::release_flat_node(ArrowSchema* schema)
+    {
+        if (schema == nullptr || schema->release == nullptr)
+        {
+            return;
+        }
+        static_cast<const shared_arrow_schema*>(schema->private_data)->release_reference();
+        reset_released_schema(schema);
+    }
+
+    void shared_arrow_schema::release_nested_node(ArrowSchema* schema)
+    {
+        if (schema == nullptr || schema->release == nullptr)
+        {
+            return;
+        }
+        auto* private_data = static_cast<nested_schema_node*>(schema->private_data);
+        for (ArrowSchema*& child : private_data->children)
+        {
+            release_exported_child(child);
+        }
+        release_exported_child(private_data->dictionary);
+        private_data->owner->release_reference();
+        delete private_data;
+        reset_released_schema(schema);
+    }
+}
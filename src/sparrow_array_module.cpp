@@ -11,23 +11,34 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <string>
-#include <tuple>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/pair.h>
+#include <nanobind/stl/string_view.h>
 #include <nanobind/stl/vector.h>
 
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
 #include <sparrow-rockfinch/detail/sparrow_array_numpy_interop.hpp>
+#include <sparrow-rockfinch/detail/strided_gather.hpp>
+#include <sparrow-rockfinch/dlpack.hpp>
 #include <sparrow-rockfinch/pycapsule.hpp>
 
 #include <sparrow/arrow_interface/arrow_schema.hpp>
-#include <sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/list_array.hpp>
 #include <sparrow/types/data_type.hpp>
 
 namespace nb = nanobind;
@@ -104,294 +115,2055 @@ namespace sparrow::rockfinch::detail
     {
         if (buffer.ndim != 1)
         {
-            throw nb::value_error("SparrowArray.from_ndarray() only supports 1D ndarrays");
+            throw nb::value_error("SparrowArray.from_ndarray() only supports 1D and 2D ndarrays");
         }
 
         const auto size = static_cast<std::size_t>(buffer.shape[0]);
-        const auto itemsize = static_cast<std::size_t>(buffer.itemsize);
+        const auto stride = static_cast<std::ptrdiff_t>(buffer.strides != nullptr ? buffer.strides[0] : buffer.itemsize);
+        const bool contiguous = size <= 1 || stride == static_cast<std::ptrdiff_t>(buffer.itemsize);
+        return {size, stride, contiguous};
+    }
+
+    namespace
+    {
+        enum class numpy_scalar_kind : std::uint8_t
+        {
+            none,
+            boolean,
+            signed_integer,
+            unsigned_integer,
+            floating
+        };
+
+        // Kind of each struct-module format character (see the buffer protocol)
+        constexpr std::array<numpy_scalar_kind, 128> numpy_format_kinds = []
+        {
+            std::array<numpy_scalar_kind, 128> kinds{};
+            kinds['?'] = numpy_scalar_kind::boolean;
+            for (const char code : std::string_view("bhilqn"))
+            {
+                kinds[static_cast<std::size_t>(code)] = numpy_scalar_kind::signed_integer;
+            }
+            for (const char code : std::string_view("BHILQN"))
+            {
+                kinds[static_cast<std::size_t>(code)] = numpy_scalar_kind::unsigned_integer;
+            }
+            kinds['e'] = numpy_scalar_kind::floating;
+            kinds['f'] = numpy_scalar_kind::floating;
+            kinds['d'] = numpy_scalar_kind::floating;
+            return kinds;
+        }();
+
+        // Element type by kind and log2 of the item size (1, 2, 4 and 8 bytes)
+        constexpr numpy_buffer_type numpy_buffer_types[5][4] = {
+            {numpy_buffer_type::unsupported,
+             numpy_buffer_type::unsupported,
+             numpy_buffer_type::unsupported,
+             numpy_buffer_type::unsupported},
+            {numpy_buffer_type::boolean,
+             numpy_buffer_type::unsupported,
+             numpy_buffer_type::unsupported,
+             numpy_buffer_type::unsupported},
+            {numpy_buffer_type::int8, numpy_buffer_type::int16, numpy_buffer_type::int32, numpy_buffer_type::int64},
+            {numpy_buffer_type::uint8, numpy_buffer_type::uint16, numpy_buffer_type::uint32, numpy_buffer_type::uint64},
+            {numpy_buffer_type::unsupported,
+             numpy_buffer_type::float16,
+             numpy_buffer_type::float32,
+             numpy_buffer_type::float64}
+        };
+
+        bool is_native_byte_order_prefix(char prefix) noexcept
+        {
+            if (prefix == '@' || prefix == '=')
+            {
+                return true;
+            }
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return prefix == '<';
+            }
+            else
+            {
+                return prefix == '>' || prefix == '!';
+            }
+        }
+    }
+
+    numpy_buffer_type numpy_buffer_type_of(const Py_buffer& buffer) noexcept
+    {
+        // A missing format means unsigned bytes
+        const char* format = buffer.format != nullptr ? buffer.format : "B";
+        // The byte order is handled by the import, see numpy_buffer_is_byte_swapped
+        if (std::string_view("@=<>!").find(format[0]) != std::string_view::npos)
+        {
+            ++format;
+        }
+        const auto code = static_cast<unsigned char>(format[0]);
+        if (code >= numpy_format_kinds.size() || format[1] != '\0')
+        {
+            return numpy_buffer_type::unsupported;
+        }
+
+        std::size_t size_index = 0;
+        switch (buffer.itemsize)
+        {
+            case 1:
+                size_index = 0;
+                break;
+            case 2:
+                size_index = 1;
+                break;
+            case 4:
+                size_index = 2;
+                break;
+            case 8:
+                size_index = 3;
+                break;
+            default:
+                return numpy_buffer_type::unsupported;
+        }
+        return numpy_buffer_types[static_cast<std::size_t>(numpy_format_kinds[code])][size_index];
+    }
+
+    bool numpy_buffer_is_byte_swapped(const Py_buffer& buffer) noexcept
+    {
+        return buffer.format != nullptr && buffer.itemsize > 1
+               && std::string_view("@=<>!").find(buffer.format[0]) != std::string_view::npos
+               && !is_native_byte_order_prefix(buffer.format[0]);
+    }
+
+    std::pair<aligned_buffer, std::size_t> pack_numpy_bools(const void* data, std::size_t size, bool invert)
+    {
+        auto bitmap = make_aligned_buffer((size + 7) / 8);
+        const std::size_t set_bits = pack_bits(
+            static_cast<const std::uint8_t*>(data),
+            size,
+            reinterpret_cast<std::uint8_t*>(bitmap.get()),
+            invert
+        );
+        return {std::move(bitmap), set_bits};
+    }
+
+    aligned_buffer gather_numpy_buffer(const Py_buffer& buffer, const ndarray_input_info& info)
+    {
+        const auto item_size = static_cast<std::size_t>(buffer.itemsize);
+        auto values = make_aligned_buffer(info.size * item_size);
+        std::optional<nb::gil_scoped_release> released;
+        if (info.size * item_size >= parallel_gather_min_bytes)
+        {
+            released.emplace();
+        }
+        const auto* source = static_cast<const std::byte*>(buffer.buf);
+        if (numpy_buffer_is_byte_swapped(buffer))
+        {
+            gather_strided_byteswap(source, info.stride, item_size, info.size, values.get());
+        }
+        else
+        {
+            gather_strided(source, info.stride, item_size, info.size, values.get());
+        }
+        return values;
+    }
+
+    namespace
+    {
+        ArrowSchema make_primitive_arrow_schema(std::string_view format)
+        {
+            return sparrow::make_arrow_schema<std::string_view, std::string_view, std::vector<sparrow::metadata_pair>>(
+                format,
+                std::string_view{},
+                std::nullopt,
+                std::nullopt,
+                nullptr,
+                std::array<bool, 0>{},
+                nullptr,
+                false
+            );
+        }
+    }
+
+    SparrowArray sparrow_array_from_borrowed_buffer(
+        const void* data,
+        std::size_t size,
+        std::string_view format,
+        const nb::object& owner,
+        bool writable,
+        aligned_buffer validity,
+        std::size_t null_count
+    )
+    {
+        auto buffers = std::make_unique<const void*[]>(2);
+        buffers[0] = validity.get();  // validity bitmap, owned by the private data
+        buffers[1] = data;            // value buffer
+
+        Py_INCREF(owner.ptr());
+        auto private_data = std::make_unique<numpy_arrow_array_private_data>();
+        private_data->owner = owner.ptr();
+        private_data->buffers = buffers.get();
+        private_data->writable = writable;
+        private_data->validity = std::move(validity);
+
+        ArrowArray arrow_array{};
+        arrow_array.length = static_cast<int64_t>(size);
+        arrow_array.null_count = static_cast<int64_t>(null_count);
+        arrow_array.offset = 0;
+        arrow_array.n_buffers = 2;
+        arrow_array.n_children = 0;
+        arrow_array.buffers = buffers.get();
+        arrow_array.children = nullptr;
+        arrow_array.dictionary = nullptr;
+        arrow_array.private_data = private_data.get();
+        arrow_array.release = &release_numpy_arrow_array;
+
+        try
+        {
+            SparrowArray result(sparrow::array(std::move(arrow_array), make_primitive_arrow_schema(format)));
+            buffers.release();
+            private_data.release();
+            return result;
+        }
+        catch (...)
+        {
+            Py_DECREF(owner.ptr());
+            throw;
+        }
+    }
+
+    SparrowArray sparrow_array_from_numpy_buffer(
+        const void* data,
+        std::size_t size,
+        std::string_view format,
+        const nb::object& owner,
+        bool writable,
+        aligned_buffer validity,
+        std::size_t null_count
+    )
+    {
+        SparrowArray result = sparrow_array_from_borrowed_buffer(
+            data,
+            size,
+            format,
+            owner,
+            writable,
+            std::move(validity),
+            null_count
+        );
+        result.set_numpy_owner(owner.ptr(), writable);
+        return result;
+    }
 
-        if (size > 1 && buffer.strides != nullptr && buffer.strides[0] != static_cast<Py_ssize_t>(itemsize))
+    SparrowArray sparrow_array_from_aligned_buffer(
+        aligned_buffer values,
+        std::size_t size,
+        std::string_view format,
+        aligned_buffer validity,
+        std::size_t null_count
+    )
+    {
+        ArrowArray arrow_array{};
+        auto* private_data = new shared_arrow_array_private_data{};
+        private_data->buffers = {validity.get(), values.get()};
+        private_data->storage.push_back(std::move(values));
+        if (private_data->buffers[0] != nullptr)
         {
-            throw nb::value_error("SparrowArray.from_ndarray() requires a contiguous 1D ndarray");
+            private_data->storage.push_back(std::move(validity));
         }
+        arrow_array.length = static_cast<int64_t>(size);
+        arrow_array.null_count = static_cast<int64_t>(null_count);
+        arrow_array.offset = 0;
+        arrow_array.n_buffers = 2;
+        arrow_array.n_children = 0;
+        arrow_array.buffers = private_data->buffers.data();
+        arrow_array.children = nullptr;
+        arrow_array.dictionary = nullptr;
+        arrow_array.private_data = private_data;
+        arrow_array.release = &release_shared_arrow_array;
 
-        return {size};
+        try
+        {
+            return SparrowArray(sparrow::array(std::move(arrow_array), make_primitive_arrow_schema(format)));
+        }
+        catch (...)
+        {
+            arrow_array.release(&arrow_array);
+            throw;
+        }
     }
 
-    bool numpy_dtype_equals(const nb::object& dtype, const char* spec)
+    SparrowArray sparrow_array_from_bool_ndarray(
+        const Py_buffer& buffer,
+        const ndarray_input_info& info,
+        aligned_buffer validity,
+        std::size_t null_count
+    )
+    {
+        aligned_buffer gathered;
+        const void* values = buffer.buf;
+        if (!info.contiguous)
+        {
+            gathered = gather_numpy_buffer(buffer, info);
+            values = gathered.get();
+        }
+        return sparrow_array_from_aligned_buffer(
+            pack_numpy_bools(values, info.size, false).first,
+            info.size,
+            "b",
+            std::move(validity),
+            null_count
+        );
+    }
+
+    std::pair<aligned_buffer, std::size_t> validity_from_numpy_mask(const nb::object& array_obj, const nb::object& mask)
     {
         static nb::module_ numpy = nb::module_::import_("numpy");
-        return python_objects_equal(dtype, numpy.attr("dtype")(spec));
+        if (nb::cast<int>(array_obj.attr("ndim")) != 1)
+        {
+            throw nb::value_error("SparrowArray.from_ndarray() only supports nulls in 1D ndarrays");
+        }
+        const nb::object mask_array = numpy.attr("asarray")(mask, nb::arg("dtype") = "bool");
+        const nb::object mask_shape = mask_array.attr("shape");
+        const nb::object array_shape = array_obj.attr("shape");
+        if (!python_objects_equal(mask_shape, array_shape))
+        {
+            throw nb::value_error("SparrowArray.from_ndarray() requires a mask of the same shape as the ndarray");
+        }
+
+        const python_buffer_guard mask_guard(mask_array.ptr(), PyBUF_RECORDS_RO);
+        const auto& buffer = mask_guard.view();
+        const auto info = validate_numpy_input(buffer);
+        aligned_buffer gathered;
+        const void* nulls = buffer.buf;
+        if (!info.contiguous)
+        {
+            gathered = gather_numpy_buffer(buffer, info);
+            nulls = gathered.get();
+        }
+        // Inverted: a set bit marks a valid value
+        auto [validity, valid_count] = pack_numpy_bools(nulls, info.size, true);
+        const std::size_t null_count = info.size - valid_count;
+        if (null_count == 0)
+        {
+            validity.reset();
+        }
+        return {std::move(validity), null_count};
+    }
+
+    namespace
+    {
+        nb::type_error unsupported_ndarray_dtype(const nb::object& array_obj)
+        {
+            return nb::type_error(
+                ("Unsupported ndarray dtype for SparrowArray.from_ndarray(): "
+                 + numpy_dtype_to_string(array_obj.attr("dtype"))
+                 + ". Supported dtypes are bool, int8/16/32/64, uint8/16/32/64, float16, float32, float64, "
+                   "datetime64[D/s/ms/us/ns] and timedelta64[s/ms/us/ns].")
+                    .c_str()
+            );
+        }
+
+        // Arrow formats of the datetime64 and timedelta64 units shared without conversion
+        struct numpy_time_unit_formats
+        {
+            std::string_view unit;
+            std::string_view timestamp;
+            std::string_view duration;
+        };
+
+        constexpr std::array<numpy_time_unit_formats, 4> numpy_time_units = {{
+            {"s", "tss:", "tDs"},
+            {"ms", "tsm:", "tDm"},
+            {"us", "tsu:", "tDu"},
+            {"ns", "tsn:", "tDn"},
+        }};
     }
 
-    SparrowArray sparrow_array_from_ndarray(const nb::object& array_obj)
+    SparrowArray sparrow_array_from_temporal_ndarray(
+        const nb::object& array_obj,
+        bool align,
+        aligned_buffer validity,
+        std::size_t null_count
+    )
     {
-        python_buffer_guard buffer_guard(array_obj.ptr(), PyBUF_STRIDED_RO);
+        static nb::module_ numpy = nb::module_::import_("numpy");
+        const nb::object dtype = array_obj.attr("dtype");
+        const nb::object kind_obj = dtype.attr("kind");
+        const auto kind = nb::cast<std::string_view>(kind_obj);
+        if (kind != "M" && kind != "m")
+        {
+            throw unsupported_ndarray_dtype(array_obj);
+        }
+        const auto unit_and_count = nb::cast<nb::tuple>(numpy.attr("datetime_data")(dtype));
+        const auto unit = nb::cast<std::string_view>(unit_and_count[0]);
+        if (nb::cast<long long>(unit_and_count[1]) != 1)
+        {
+            throw unsupported_ndarray_dtype(array_obj);
+        }
+        const bool is_date = kind == "M" && unit == "D";
+        std::string_view format;
+        for (const auto& formats : numpy_time_units)
+        {
+            if (formats.unit == unit)
+            {
+                format = kind == "M" ? formats.timestamp : formats.duration;
+            }
+        }
+        if (format.empty() && !is_date)
+        {
+            throw unsupported_ndarray_dtype(array_obj);
+        }
+
+        // Same memory, described as int64 (of the same byte order) through the buffer protocol
+        const nb::object int64_dtype = numpy.attr("dtype")("int64").attr("newbyteorder")(dtype.attr("byteorder"));
+        const python_buffer_guard buffer_guard(array_obj.attr("view")(int64_dtype).ptr(), PyBUF_RECORDS_RO);
         const auto& buffer = buffer_guard.view();
+        if (buffer.ndim == 2)
+        {
+            return sparrow_array_from_matrix(array_obj, buffer, align);
+        }
         const auto input_info = validate_numpy_input(buffer);
-        nb::object dtype = array_obj.attr("dtype");
 
-        if (numpy_dtype_equals(dtype, "bool"))
+        aligned_buffer gathered;
+        const auto* values = static_cast<const std::int64_t*>(buffer.buf);
+        if (!input_info.contiguous || numpy_buffer_is_byte_swapped(buffer))
+        {
+            gathered = gather_numpy_buffer(buffer, input_info);
+            values = reinterpret_cast<const std::int64_t*>(gathered.get());
+        }
+
+        auto nat_validity = make_aligned_buffer((input_info.size + 7) / 8);
+        auto* nat_bits = reinterpret_cast<std::uint8_t*>(nat_validity.get());
+        const std::size_t nat_count = input_info.size - pack_not_equal(values, input_info.size, numpy_nat, nat_bits);
+        if (nat_count != 0 && validity != nullptr)
+        {
+            // Null where masked or NaT
+            auto* bits = reinterpret_cast<std::uint8_t*>(validity.get());
+            for (std::size_t i = 0; i < (input_info.size + 7) / 8; ++i)
+            {
+                bits[i] &= nat_bits[i];
+            }
+            null_count = input_info.size - count_set_bits(bits, 0, input_info.size);
+        }
+        else if (nat_count != 0)
+        {
+            validity = std::move(nat_validity);
+            null_count = nat_count;
+        }
+
+        if (is_date)
+        {
+            // date32 counts days on 32 bits
+            auto days = make_aligned_buffer(input_info.size * sizeof(std::int32_t));
+            auto* out = reinterpret_cast<std::int32_t*>(days.get());
+            for (std::size_t i = 0; i < input_info.size; ++i)
+            {
+                const std::int64_t day = values[i] == numpy_nat ? 0 : values[i];
+                if (day < std::numeric_limits<std::int32_t>::min() || day > std::numeric_limits<std::int32_t>::max())
+                {
+                    throw nb::value_error("SparrowArray.from_ndarray(): datetime64[D] value out of the date32 range");
+                }
+                out[i] = static_cast<std::int32_t>(day);
+            }
+            return sparrow_array_from_aligned_buffer(std::move(days), input_info.size, "tdD", std::move(validity), null_count);
+        }
+        if (gathered != nullptr)
+        {
+            // Gathered into a freshly allocated buffer: already aligned
+            return sparrow_array_from_aligned_buffer(
+                std::move(gathered),
+                input_info.size,
+                format,
+                std::move(validity),
+                null_count
+            );
+        }
+        SparrowArray result = sparrow_array_from_numpy_buffer(
+            buffer.buf,
+            input_info.size,
+            format,
+            array_obj,
+            !buffer.readonly,
+            std::move(validity),
+            null_count
+        );
+        if (align)
+        {
+            result.realign();
+        }
+        return result;
+    }
+
+    namespace
+    {
+        // Import the values of an ndarray, with the validity bitmap of its nulls if any
+        SparrowArray import_ndarray_values(
+            const nb::object& array_obj,
+            bool align,
+            aligned_buffer validity,
+            std::size_t null_count
+        )
+        {
+            std::optional<python_buffer_guard> buffer_guard;
+            try
+            {
+                buffer_guard.emplace(array_obj.ptr(), PyBUF_RECORDS_RO);
+            }
+            catch (nb::python_error& e)
+            {
+                // NumPy refuses to describe some dtypes (e.g. datetime64) with a format
+                if (!e.matches(PyExc_ValueError) || !nb::hasattr(array_obj, "dtype"))
+                {
+                    throw;
+                }
+            }
+            if (!buffer_guard.has_value())
+            {
+                return sparrow_array_from_temporal_ndarray(array_obj, align, std::move(validity), null_count);
+            }
+            const auto& buffer = buffer_guard->view();
+            if (buffer.ndim == 2)
+            {
+                return sparrow_array_from_matrix(array_obj, buffer, align);
+            }
+            const auto input_info = validate_numpy_input(buffer);
+            const bool byte_swapped = numpy_buffer_is_byte_swapped(buffer);
+
+            const auto make = [&]<typename T>() -> SparrowArray
+            {
+                if (!input_info.contiguous || byte_swapped)
+                {
+                    // Gathered (and byte-swapped) into a freshly allocated buffer: already aligned
+                    return sparrow_array_from_aligned_buffer(
+                        gather_numpy_buffer(buffer, input_info),
+                        input_info.size,
+                        arrow_format_for<T>(),
+                        std::move(validity),
+                        null_count
+                    );
+                }
+                SparrowArray result = sparrow_array_from_numpy_buffer(
+                    buffer.buf,
+                    input_info.size,
+                    arrow_format_for<T>(),
+                    array_obj,
+                    !buffer.readonly,
+                    std::move(validity),
+                    null_count
+                );
+                if (align)
+                {
+                    result.realign();
+                }
+                return result;
+            };
+
+            switch (numpy_buffer_type_of(buffer))
+            {
+                case numpy_buffer_type::boolean:
+                    // Packed into a freshly allocated bitmap: already aligned
+                    return sparrow_array_from_bool_ndarray(buffer, input_info, std::move(validity), null_count);
+                case numpy_buffer_type::int8:
+                    return make.template operator()<std::int8_t>();
+                case numpy_buffer_type::uint8:
+                    return make.template operator()<std::uint8_t>();
+                case numpy_buffer_type::int16:
+                    return make.template operator()<std::int16_t>();
+                case numpy_buffer_type::uint16:
+                    return make.template operator()<std::uint16_t>();
+                case numpy_buffer_type::int32:
+                    return make.template operator()<std::int32_t>();
+                case numpy_buffer_type::uint32:
+                    return make.template operator()<std::uint32_t>();
+                case numpy_buffer_type::int64:
+                    return make.template operator()<std::int64_t>();
+                case numpy_buffer_type::uint64:
+                    return make.template operator()<std::uint64_t>();
+                case numpy_buffer_type::float16:
+                    return make.template operator()<sparrow::float16_t>();
+                case numpy_buffer_type::float32:
+                    return make.template operator()<float>();
+                case numpy_buffer_type::float64:
+                    return make.template operator()<double>();
+                case numpy_buffer_type::unsupported:
+                    break;
+            }
+            throw unsupported_ndarray_dtype(array_obj);
+        }
+
+        // Null mask of the values equal to `null_sentinel`
+        nb::object sentinel_null_mask(const nb::object& values, const nb::object& null_sentinel)
+        {
+            static nb::module_ numpy = nb::module_::import_("numpy");
+            // NaN never compares equal to itself
+            if (nb::isinstance<nb::float_>(null_sentinel) && std::isnan(nb::cast<double>(null_sentinel)))
+            {
+                return numpy.attr("isnan")(values);
+            }
+            return numpy.attr("equal")(values, null_sentinel);
+        }
+    }
+
+    SparrowArray sparrow_array_from_ndarray(
+        const nb::object& array_obj,
+        bool align,
+        const nb::object& mask,
+        const nb::object& null_sentinel
+    )
+    {
+        static nb::module_ numpy_ma = nb::module_::import_("numpy.ma");
+        static nb::object masked_array_type = numpy_ma.attr("MaskedArray");
+        const int is_masked_array = PyObject_IsInstance(array_obj.ptr(), masked_array_type.ptr());
+        if (is_masked_array < 0)
+        {
+            throw nb::python_error();
+        }
+        if (is_masked_array == 0 && mask.is_none() && null_sentinel.is_none())
+        {
+            return import_ndarray_values(array_obj, align, nullptr, 0);
+        }
+
+        nb::object values = array_obj;
+        nb::object null_mask = mask;
+        if (is_masked_array != 0)
+        {
+            if (!mask.is_none())
+            {
+                throw nb::value_error("SparrowArray.from_ndarray() does not accept a mask for a MaskedArray");
+            }
+            values = array_obj.attr("data");
+            null_mask = numpy_ma.attr("getmask")(array_obj);
+            if (null_mask.is(numpy_ma.attr("nomask")))
+            {
+                null_mask = nb::none();
+            }
+        }
+        if (!null_sentinel.is_none())
+        {
+            if (!null_mask.is_none())
+            {
+                throw nb::value_error("SparrowArray.from_ndarray() takes either a mask or a null_sentinel, not both");
+            }
+            null_mask = sentinel_null_mask(values, null_sentinel);
+        }
+        if (null_mask.is_none())
+        {
+            return import_ndarray_values(values, align, nullptr, 0);
+        }
+        auto [validity, null_count] = validity_from_numpy_mask(values, null_mask);
+        return import_ndarray_values(values, align, std::move(validity), null_count);
+    }
+
+    SparrowArray sparrow_array_from_matrix(const nb::object& array_obj, const Py_buffer& buffer, bool align)
+    {
+        const auto list_size = static_cast<std::uint64_t>(buffer.shape[1]);
+        if (list_size == 0)
         {
-            const auto size = input_info.size;
-            const auto* data = static_cast<const bool*>(buffer.buf);
+            throw nb::value_error("SparrowArray.from_ndarray() requires 2D ndarrays with at least one column");
+        }
+        if (PyBuffer_IsContiguous(&buffer, 'C') == 0)
+        {
+            static nb::module_ numpy = nb::module_::import_("numpy");
+            return sparrow_array_from_ndarray(numpy.attr("ascontiguousarray")(array_obj), align);
+        }
 
-            std::vector<bool> values(size);
-            std::copy_n(data, size, values.begin());
-            sparrow::primitive_array<bool> primitive(std::move(values));
-            return SparrowArray(sparrow::array(std::move(primitive)));
+        // A view of the same memory: the values keep borrowing the ndarray
+        SparrowArray values = sparrow_array_from_ndarray(array_obj.attr("reshape")(-1), align);
+        const bool borrowed = values.numpy_owner() != nullptr;
+        SparrowArray result(
+            sparrow::array(sparrow::fixed_sized_list_array(list_size, std::move(values.get_array()), false))
+        );
+        if (borrowed)
+        {
+            // Lets to_numpy() hand back the 2-D source
+            result.set_numpy_owner(array_obj.ptr(), !buffer.readonly);
         }
+        return result;
+    }
 
-        using supported_numeric_types = std::tuple<
-            std::int8_t,
-            std::uint8_t,
-            std::int16_t,
-            std::uint16_t,
-            std::int32_t,
-            std::uint32_t,
-            std::int64_t,
-            std::uint64_t,
-            float,
-            double>;
+    nb::object mark_numpy_array_readonly(nb::object array)
+    {
+        array.attr("setflags")(false);
+        return array;
+    }
+
+    bool parse_copy_argument(const nb::object& copy_arg)
+    {
+        if (copy_arg.is_none())
+        {
+            return false;
+        }
+
+        if (!nb::isinstance<nb::bool_>(copy_arg))
+        {
+            throw nb::type_error("__array__(copy=...) only accepts True, False, or None");
+        }
+
+        return nb::cast<bool>(copy_arg);
+    }
 
-        std::optional<SparrowArray> result;
-        auto try_make = [&]<typename T>() -> bool
+    null_export_mode parse_null_export_mode(const nb::object& nulls)
+    {
+        if (nulls.is_none())
+        {
+            return null_export_mode::raise;
+        }
+        if (nb::isinstance<nb::str>(nulls))
         {
-            if (!numpy_dtype_equals(dtype, numpy_dtype_spec<T>()))
+            const std::string_view mode = nb::cast<std::string_view>(nulls);
+            if (mode == "mask")
+            {
+                return null_export_mode::mask;
+            }
+            if (mode == "sentinel")
+            {
+                return null_export_mode::sentinel;
+            }
+        }
+        throw nb::value_error("to_numpy(nulls=...) must be None, 'mask' or 'sentinel'");
+    }
+
+    dictionary_export_mode parse_dictionary_export_mode(const nb::object& dictionary)
+    {
+        if (dictionary.is_none())
+        {
+            return dictionary_export_mode::raise;
+        }
+        if (nb::isinstance<nb::str>(dictionary) && nb::cast<std::string_view>(dictionary) == "codes")
+        {
+            return dictionary_export_mode::codes;
+        }
+        throw nb::value_error("to_numpy(dictionary=...) must be None or 'codes'");
+    }
+
+    void validate_numpy_export_supported(const sparrow::array& array, null_export_mode nulls)
+    {
+        if (array.null_count() == 0 || nulls != null_export_mode::raise)
+        {
+            return;
+        }
+
+        switch (array.data_type())
+        {
+            case sparrow::data_type::HALF_FLOAT:
+            case sparrow::data_type::FLOAT:
+            case sparrow::data_type::DOUBLE:
+                return;
+            case sparrow::data_type::BOOL:
+                throw nb::type_error("SparrowArray.to_numpy() does not support nullable bool arrays");
+            case sparrow::data_type::INT8:
+            case sparrow::data_type::UINT8:
+            case sparrow::data_type::INT16:
+            case sparrow::data_type::UINT16:
+            case sparrow::data_type::INT32:
+            case sparrow::data_type::UINT32:
+            case sparrow::data_type::INT64:
+            case sparrow::data_type::UINT64:
+                throw nb::type_error("SparrowArray.to_numpy() does not support nullable integer arrays");
+            default:
+                return;
+        }
+    }
+
+    nb::object make_numpy_null_mask(const ArrowArray* arrow_array, std::size_t size)
+    {
+        return make_numpy_copy<bool>(
+            size,
+            [&](bool* out)
+            {
+                unpack_bits(
+                    static_cast<const std::uint8_t*>(arrow_array->buffers[0]),
+                    static_cast<std::size_t>(arrow_array->offset),
+                    size,
+                    out,
+                    true
+                );
+            }
+        );
+    }
+
+    namespace
+    {
+        // NumPy dtype of a timestamp, date or duration format, nullptr for other formats
+        const char* numpy_temporal_dtype(std::string_view format) noexcept
+        {
+            if (format.size() < 3 || format[0] != 't')
+            {
+                return nullptr;
+            }
+            // Timestamps carry a time zone after "ts<unit>:", ignored by datetime64
+            if (format[1] == 's' && format.size() >= 4 && format[3] == ':')
+            {
+                switch (format[2])
+                {
+                    case 's':
+                        return "datetime64[s]";
+                    case 'm':
+                        return "datetime64[ms]";
+                    case 'u':
+                        return "datetime64[us]";
+                    case 'n':
+                        return "datetime64[ns]";
+                    default:
+                        return nullptr;
+                }
+            }
+            if (format == "tdD")
+            {
+                return "datetime64[D]";
+            }
+            if (format == "tdm")
+            {
+                return "datetime64[ms]";
+            }
+            if (format.size() == 3 && format[1] == 'D')
+            {
+                switch (format[2])
+                {
+                    case 's':
+                        return "timedelta64[s]";
+                    case 'm':
+                        return "timedelta64[ms]";
+                    case 'u':
+                        return "timedelta64[us]";
+                    case 'n':
+                        return "timedelta64[ns]";
+                    default:
+                        return nullptr;
+                }
+            }
+            return nullptr;
+        }
+
+        // Export `size` timestamps, dates or durations as datetime64 or timedelta64.
+        // The 64-bit values are viewed as-is; date32 days are widened (a copy).
+        nb::object export_temporal_values(
+            const ArrowArray* values,
+            std::string_view format,
+            const char* dtype,
+            std::size_t size,
+            nb::handle owner,
+            bool copy,
+            bool writable
+        )
+        {
+            if (format != "tdD")
+            {
+                return make_numpy_from_arrow_buffer<std::int64_t>(values, size, owner, copy, writable)
+                    .attr("view")(dtype);
+            }
+            nb::object days = make_numpy_copy<std::int64_t>(
+                size,
+                [&](std::int64_t* out)
+                {
+                    const auto* src = static_cast<const std::int32_t*>(values->buffers[1]) + values->offset;
+                    std::copy_n(src, size, out);
+                },
+                !copy && !writable
+            );
+            return days.attr("view")(dtype);
+        }
+
+        // Copy `size` nullable timestamps, dates or durations with NaT in place of the nulls
+        nb::object make_numpy_temporal_copy_with_nat_nulls(
+            const ArrowArray* values,
+            std::string_view format,
+            const char* dtype,
+            std::size_t size
+        )
+        {
+            nb::object integers = format == "tdD"
+                                      ? make_numpy_copy_with_null_fill<std::int32_t>(values, size, numpy_nat)
+                                      : make_numpy_copy_with_null_fill<std::int64_t>(values, size, numpy_nat);
+            return integers.attr("view")(dtype);
+        }
+
+        // Creates the str (or bytes) objects of a string column. While the column looks
+        // low-cardinality, the object of a value already seen is reused instead.
+        class python_string_factory
+        {
+        public:
+
+            explicit python_string_factory(bool binary)
+                : m_binary(binary)
+            {
+            }
+
+            python_string_factory(const python_string_factory&) = delete;
+            python_string_factory& operator=(const python_string_factory&) = delete;
+
+            ~python_string_factory()
+            {
+                stop_deduplicating();
+            }
+
+            // New reference to the object of `value`
+            PyObject* make(std::string_view value)
+            {
+                if (!m_deduplicating)
+                {
+                    return create(value);
+                }
+                const auto [it, inserted] = m_seen.try_emplace(value, nullptr);
+                ++m_lookups;
+                if (!inserted)
+                {
+                    Py_INCREF(it->second);
+                    return it->second;
+                }
+                PyObject* object = create_or_erase(it);
+                // One reference for the caller, one for the cache
+                Py_INCREF(object);
+                it->second = object;
+                if (m_lookups >= deduplication_probe && m_seen.size() * 2 > m_lookups)
+                {
+                    // Mostly distinct values: hashing them is wasted work
+                    stop_deduplicating();
+                }
+                return object;
+            }
+
+        private:
+
+            // Lookups after which deduplication stops unless at most half of the values were new
+            static constexpr std::size_t deduplication_probe = 1024;
+
+            using cache = std::unordered_map<std::string_view, PyObject*>;
+
+            PyObject* create(std::string_view value) const
+            {
+                const auto length = static_cast<Py_ssize_t>(value.size());
+                PyObject* object = m_binary ? PyBytes_FromStringAndSize(value.data(), length)
+                                            : PyUnicode_DecodeUTF8(value.data(), length, nullptr);
+                if (object == nullptr)
+                {
+                    throw nb::python_error();
+                }
+                return object;
+            }
+
+            PyObject* create_or_erase(cache::iterator it)
+            {
+                try
+                {
+                    return create(it->first);
+                }
+                catch (...)
+                {
+                    m_seen.erase(it);
+                    throw;
+                }
+            }
+
+            void stop_deduplicating() noexcept
+            {
+                for (const auto& [value, object] : m_seen)
+                {
+                    Py_DECREF(object);
+                }
+                m_seen.clear();
+                m_deduplicating = false;
+            }
+
+            bool m_binary;
+            bool m_deduplicating = true;
+            std::size_t m_lookups = 0;
+            cache m_seen;
+        };
+
+        bool is_string_format(std::string_view format) noexcept
+        {
+            return format == "u" || format == "U" || format == "z" || format == "Z";
+        }
+
+        // The str (bytes for binary formats) objects of `size` values of a (large)
+        // utf8 or binary ArrowArray, with None for the nulls
+        template <typename O>
+        nb::list make_python_strings(const ArrowArray* values, std::size_t size, bool binary)
+        {
+            PyObject* list = PyList_New(static_cast<Py_ssize_t>(size));
+            if (list == nullptr)
+            {
+                throw nb::python_error();
+            }
+            // The items not set yet are null, which the list tolerates on error
+            nb::list result = nb::steal<nb::list>(list);
+
+            const auto* validity = static_cast<const std::uint8_t*>(values->buffers[0]);
+            const bool has_nulls = values->null_count != 0 && validity != nullptr;
+            const auto offset = static_cast<std::size_t>(values->offset);
+            const auto* offsets = static_cast<const O*>(values->buffers[1]) + offset;
+            const auto* data = static_cast<const char*>(values->buffers[2]);
+            python_string_factory factory(binary);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                PyObject* item = nullptr;
+                if (has_nulls && !bit_is_set(validity, offset + i))
+                {
+                    Py_INCREF(Py_None);
+                    item = Py_None;
+                }
+                else
+                {
+                    const auto length = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+                    item = factory.make(length == 0 ? std::string_view() : std::string_view(data + offsets[i], length));
+                }
+                PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i), item);
+            }
+            return result;
+        }
+
+        // Export `size` strings as a StringDType array (NumPy 2, utf8 only) or an object
+        // array; either way a copy, with None in place of the nulls
+        nb::object export_string_values(const ArrowArray* values, std::string_view format, std::size_t size, bool readonly)
+        {
+            static nb::module_ numpy = nb::module_::import_("numpy");
+            static const nb::object string_dtype = nb::hasattr(numpy.attr("dtypes"), "StringDType")
+                                                       ? nb::object(numpy.attr("dtypes").attr("StringDType"))
+                                                       : nb::none();
+
+            const bool binary = format == "z" || format == "Z";
+            nb::list strings = format == "u" || format == "z" ? make_python_strings<std::int32_t>(values, size, binary)
+                                                              : make_python_strings<std::int64_t>(values, size, binary);
+            nb::object dtype = nb::str("object");
+            if (!binary && !string_dtype.is_none())
+            {
+                dtype = values->null_count != 0 ? string_dtype(nb::arg("na_object") = nb::none()) : string_dtype();
+            }
+            nb::object array = numpy.attr("array")(strings, nb::arg("dtype") = dtype);
+            return readonly ? mark_numpy_array_readonly(std::move(array)) : array;
+        }
+
+        // Export `size` values of a primitive ArrowArray, from its offset on
+        nb::object export_primitive_values(
+            const ArrowArray* values,
+            const ArrowSchema* schema,
+            std::size_t size,
+            nb::handle owner,
+            bool copy,
+            bool writable
+        )
+        {
+            if (const char* dtype = numpy_temporal_dtype(schema->format))
+            {
+                return export_temporal_values(values, schema->format, dtype, size, owner, copy, writable);
+            }
+            if (is_string_format(schema->format))
+            {
+                return export_string_values(values, schema->format, size, !copy && !writable);
+            }
+            switch (sparrow::format_to_data_type(schema->format))
+            {
+                case sparrow::data_type::BOOL:
+                    return make_numpy_copy<bool>(
+                        size,
+                        [&](bool* out)
+                        {
+                            unpack_bits(
+                                static_cast<const std::uint8_t*>(values->buffers[1]),
+                                static_cast<std::size_t>(values->offset),
+                                size,
+                                out,
+                                false
+                            );
+                        },
+                        !copy && !writable
+                    );
+                case sparrow::data_type::INT8:
+                    return make_numpy_from_arrow_buffer<std::int8_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::UINT8:
+                    return make_numpy_from_arrow_buffer<std::uint8_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::INT16:
+                    return make_numpy_from_arrow_buffer<std::int16_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::UINT16:
+                    return make_numpy_from_arrow_buffer<std::uint16_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::INT32:
+                    return make_numpy_from_arrow_buffer<std::int32_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::UINT32:
+                    return make_numpy_from_arrow_buffer<std::uint32_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::INT64:
+                    return make_numpy_from_arrow_buffer<std::int64_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::UINT64:
+                    return make_numpy_from_arrow_buffer<std::uint64_t>(values, size, owner, copy, writable);
+                case sparrow::data_type::FLOAT:
+                    return make_numpy_from_arrow_buffer<float>(values, size, owner, copy, writable);
+                case sparrow::data_type::DOUBLE:
+                    return make_numpy_from_arrow_buffer<double>(values, size, owner, copy, writable);
+                case sparrow::data_type::HALF_FLOAT:
+                    return make_numpy_from_arrow_buffer<sparrow::float16_t>(values, size, owner, copy, writable);
+                default:
+                    throw nb::type_error(
+                        "SparrowArray.to_numpy() only supports primitive, string and binary 1D Sparrow arrays"
+                    );
+            }
+        }
+
+        // Export `size` fixed-size lists of primitive values as a (size, list_size) array
+        nb::object export_fixed_size_list_values(
+            const ArrowArray* lists,
+            const ArrowSchema* schema,
+            std::size_t size,
+            nb::handle owner,
+            bool copy,
+            bool writable
+        )
+        {
+            const ArrowArray* child = lists->children[0];
+            if (lists->null_count != 0 || child->null_count != 0)
+            {
+                throw nb::type_error("SparrowArray.to_numpy() does not support fixed-size lists with nulls");
+            }
+
+            // Format "+w:<list_size>"
+            const auto list_size = static_cast<std::size_t>(std::strtoull(schema->format + 3, nullptr, 10));
+            // Shallow copy, only read: the values of the exported lists start at the parent offset
+            ArrowArray values = *child;
+            values.offset = child->offset + lists->offset * static_cast<std::int64_t>(list_size);
+            nb::object flat = export_primitive_values(
+                &values,
+                schema->children[0],
+                size * list_size,
+                owner,
+                copy,
+                writable
+            );
+            return flat.attr("reshape")(size, list_size);
+        }
+
+        // Whether to_numpy(copy=False) can export a view of the values of `array`, rather
+        // than a copy (bit-packed bools, widened dates, strings, nulls set to NaN or NaT)
+        bool exports_values_view(const sparrow::array& array, null_export_mode nulls)
+        {
+            if (array.null_count() != 0 && nulls != null_export_mode::mask)
             {
                 return false;
             }
-            result = sparrow_array_from_typed_ndarray<T>(
-                buffer.buf,
-                input_info.size,
-                array_obj,
-                !buffer.readonly
+            const ArrowSchema* schema = sparrow::get_arrow_schema(array);
+            if (array.data_type() == sparrow::data_type::FIXED_SIZED_LIST)
+            {
+                schema = schema->children[0];
+            }
+            const std::string_view format = schema->format;
+            return format != "b" && format != "tdD" && !is_string_format(format);
+        }
+
+        // Capsule holding the buffers of the current array of a SparrowArray, as the
+        // owner of the views over them: the SparrowArray itself may switch to other
+        // buffers (copy-on-write) while the views are alive
+        nb::capsule make_numpy_view_owner(std::shared_ptr<const void> buffers)
+        {
+            auto* handle = new std::shared_ptr<const void>(std::move(buffers));
+            return nb::capsule(
+                handle,
+                [](void* ptr) noexcept
+                {
+                    delete static_cast<std::shared_ptr<const void>*>(ptr);
+                }
+            );
+        }
+    }
+
+    nb::object sparrow_array_to_numpy(
+        SparrowArray& self,
+        bool copy,
+        null_export_mode nulls,
+        const nb::object& fill_value,
+        bool writable,
+        dictionary_export_mode dictionary
+    )
+    {
+        // Read-only access: exporting must not detach an array shared with live exports
+        const auto& source = std::as_const(self).get_array();
+        if (sparrow::get_arrow_array(source)->dictionary == nullptr)
+        {
+            if (dictionary == dictionary_export_mode::codes)
+            {
+                throw nb::type_error("SparrowArray.to_numpy(dictionary='codes') requires a dictionary-encoded array");
+            }
+        }
+        else if (dictionary != dictionary_export_mode::codes)
+        {
+            throw nb::type_error(
+                "SparrowArray.to_numpy() exports dictionary-encoded arrays as codes and categories "
+                "with dictionary='codes'"
+            );
+        }
+        else if (source.null_count() != 0 && nulls == null_export_mode::raise)
+        {
+            throw nb::type_error(
+                "SparrowArray.to_numpy() does not support nullable dictionary codes without nulls='mask' or 'sentinel'"
+            );
+        }
+        validate_numpy_export_supported(source, nulls);
+        if (nulls == null_export_mode::sentinel && fill_value.is_none())
+        {
+            throw nb::value_error("SparrowArray.to_numpy(nulls='sentinel') requires a fill_value");
+        }
+
+        const bool writable_source = self.numpy_owner() != nullptr && self.numpy_owner_writable();
+        const bool writable_view = writable && !copy && !writable_source
+                                   && exports_values_view(std::as_const(self).get_array(), nulls);
+        if (writable_view && !self.has_writable_view())
+        {
+            // Copy-on-write: only copies when the buffers are shared or borrowed. Live
+            // writable views already hold exclusive buffers, which are shared again.
+            self.make_buffers_exclusive();
+        }
+
+        const auto& array = std::as_const(self).get_array();
+        const auto* arrow_array = sparrow::get_arrow_array(array);
+        const nb::capsule owner = make_numpy_view_owner(writable_view ? self.writable_view_owner() : self.owner());
+
+        const auto export_values = [&](bool copy_values) -> nb::object
+        {
+            // Arrays imported from NumPy can hand back their source, whose values
+            // under the nulls (NaT, masked or sentinel values) are left as-is
+            if (!copy_values && self.numpy_owner() != nullptr && (!writable || self.numpy_owner_writable()))
+            {
+                return nb::borrow<nb::object>(self.numpy_owner());
+            }
+
+            if (array.data_type() == sparrow::data_type::FIXED_SIZED_LIST)
+            {
+                return export_fixed_size_list_values(
+                    arrow_array,
+                    sparrow::get_arrow_schema(array),
+                    array.size(),
+                    owner,
+                    copy_values,
+                    writable
+                );
+            }
+            return export_primitive_values(
+                arrow_array,
+                sparrow::get_arrow_schema(array),
+                array.size(),
+                owner,
+                copy_values,
+                writable
             );
-            return true;
         };
 
-        if (std::apply(
-                [&](auto... types)
-                {
-                    return (try_make.template operator()<decltype(types)>() || ...);
-                },
-                supported_numeric_types{}
-            ))
+        const bool has_nulls = array.null_count() != 0;
+        switch (nulls)
+        {
+            case null_export_mode::mask:
+            {
+                static nb::module_ numpy_ma = nb::module_::import_("numpy.ma");
+                nb::object values = export_values(copy);
+                nb::object mask = has_nulls ? make_numpy_null_mask(arrow_array, array.size())
+                                            : nb::object(numpy_ma.attr("nomask"));
+                return numpy_ma.attr("MaskedArray")(values, nb::arg("mask") = mask);
+            }
+            case null_export_mode::sentinel:
+            {
+                if (!has_nulls)
+                {
+                    return export_values(copy);
+                }
+                static nb::module_ numpy = nb::module_::import_("numpy");
+                nb::object values = export_values(true);
+                numpy.attr("copyto")(
+                    values,
+                    fill_value,
+                    nb::arg("where") = make_numpy_null_mask(arrow_array, array.size())
+                );
+                return values;
+            }
+            case null_export_mode::raise:
+            default:
+                if (has_nulls)
+                {
+                    // Nullable temporal arrays are copied with NaT sentinels
+                    const char* format = sparrow::get_arrow_schema(array)->format;
+                    if (const char* dtype = numpy_temporal_dtype(format))
+                    {
+                        return make_numpy_temporal_copy_with_nat_nulls(arrow_array, format, dtype, array.size());
+                    }
+                    // Nullable floating-point arrays are copied with NaN sentinels
+                    switch (array.data_type())
+                    {
+                        case sparrow::data_type::HALF_FLOAT:
+                            return make_numpy_copy_with_null_fill<sparrow::float16_t>(
+                                arrow_array,
+                                array.size(),
+                                quiet_nan<sparrow::float16_t>()
+                            );
+                        case sparrow::data_type::FLOAT:
+                            return make_numpy_copy_with_null_fill<float>(arrow_array, array.size(), quiet_nan<float>());
+                        case sparrow::data_type::DOUBLE:
+                            return make_numpy_copy_with_null_fill<double>(arrow_array, array.size(), quiet_nan<double>());
+                        default:
+                            break;
+                    }
+                }
+                return export_values(copy);
+        }
+    }
+
+    nb::object sparrow_array_dictionary_to_numpy(SparrowArray& self, bool copy)
+    {
+        const auto& array = std::as_const(self).get_array();
+        const ArrowArray* dictionary = sparrow::get_arrow_array(array)->dictionary;
+        if (dictionary == nullptr)
+        {
+            throw nb::type_error("SparrowArray is not dictionary-encoded");
+        }
+        if (dictionary->null_count != 0)
+        {
+            throw nb::type_error("SparrowArray.to_numpy() does not support dictionaries with nulls");
+        }
+        return export_primitive_values(
+            dictionary,
+            sparrow::get_arrow_schema(array)->dictionary,
+            static_cast<std::size_t>(dictionary->length),
+            make_numpy_view_owner(self.owner()),
+            copy,
+            false
+        );
+    }
+
+    nb::object sparrow_array_to_numpy_method(
+        SparrowArray& self,
+        bool copy,
+        const nb::object& nulls,
+        const nb::object& fill_value,
+        bool writable,
+        const nb::object& dictionary
+    )
+    {
+        const dictionary_export_mode dictionary_mode = parse_dictionary_export_mode(dictionary);
+        nb::object values = sparrow_array_to_numpy(
+            self,
+            copy,
+            parse_null_export_mode(nulls),
+            fill_value,
+            writable,
+            dictionary_mode
+        );
+        if (dictionary_mode == dictionary_export_mode::codes)
+        {
+            return nb::make_tuple(values, sparrow_array_dictionary_to_numpy(self, copy));
+        }
+        return values;
+    }
+
+    nb::object sparrow_array_to_categorical(SparrowArray& self)
+    {
+        static nb::module_ pandas = nb::module_::import_("pandas");
+        const auto& array = std::as_const(self).get_array();
+        const bool has_nulls = array.null_count() != 0;
+        const bool ordered = (sparrow::get_arrow_schema(array)->flags & ARROW_FLAG_DICTIONARY_ORDERED) != 0;
+
+        // pandas marks the nulls with the code -1
+        nb::object codes = sparrow_array_to_numpy(
+            self,
+            false,
+            has_nulls ? null_export_mode::sentinel : null_export_mode::raise,
+            nb::int_(-1),
+            false,
+            dictionary_export_mode::codes
+        );
+        nb::object categories = sparrow_array_dictionary_to_numpy(self, false);
+        const nb::object kind = categories.attr("dtype").attr("kind");
+        if (nb::cast<std::string_view>(kind) == "T")
+        {
+            // The categories of pandas do not take StringDType yet; only the dictionary is converted
+            categories = categories.attr("astype")("object");
+        }
+        return pandas.attr("Categorical").attr("from_codes")(
+            codes,
+            nb::arg("categories") = categories,
+            nb::arg("ordered") = ordered
+        );
+    }
+
+    nb::object sparrow_array_dunder_array(SparrowArray& self, nb::object dtype, nb::object copy)
+    {
+        nb::object result = sparrow_array_to_numpy(self, parse_copy_argument(copy));
+
+        if (!dtype.is_none())
+        {
+            nb::module_ numpy = nb::module_::import_("numpy");
+            nb::object requested_dtype = numpy.attr("dtype")(dtype);
+            nb::object native_dtype = result.attr("dtype");
+
+            if (!python_objects_equal(requested_dtype, native_dtype))
+            {
+                throw nb::type_error("SparrowArray.__array__() does not support dtype conversion requests");
+            }
+        }
+
+        return result;
+    }
+
+    SparrowArray
+    sparrow_array_from_arrow(const nb::object& arrow_array, bool lazy, std::string_view validate, bool align)
+    {
+        const validation_mode mode = parse_validation_mode(validate);
+        const bool has_array = nb::hasattr(arrow_array, "__arrow_c_array__");
+        if (!has_array && !nb::hasattr(arrow_array, "__arrow_c_device_array__"))
+        {
+            throw nb::type_error(
+                "Input object must implement __arrow_c_array__ (ArrowArrayExportable protocol) "
+                "or __arrow_c_device_array__ (ArrowDeviceArrayExportable protocol)"
+            );
+        }
+
+        const char* method = has_array ? "__arrow_c_array__" : "__arrow_c_device_array__";
+        nb::object capsules = arrow_array.attr(method)();
+
+        if (!nb::isinstance<nb::tuple>(capsules) || nb::len(capsules) != 2)
+        {
+            throw nb::type_error((std::string(method) + " must return a tuple of 2 elements").c_str());
+        }
+
+        auto capsule_tuple = nb::cast<nb::tuple>(capsules);
+        if (lazy)
+        {
+            std::shared_ptr<detail::lazy_arrow_array> holder =
+                has_array ? import_lazy_array_from_capsules(capsule_tuple[0].ptr(), capsule_tuple[1].ptr(), mode)
+                          : import_lazy_array_from_device_capsules(capsule_tuple[0].ptr(), capsule_tuple[1].ptr(), mode);
+            if (holder == nullptr)
+            {
+                throw nb::python_error();
+            }
+            SparrowArray result(std::move(holder));
+            if (align)
+            {
+                result.realign();
+            }
+            return result;
+        }
+        sparrow::array arr = has_array
+                                 ? import_array_from_capsules(capsule_tuple[0].ptr(), capsule_tuple[1].ptr(), mode)
+                                 : import_array_from_device_capsules(capsule_tuple[0].ptr(), capsule_tuple[1].ptr(), mode);
+        if (PyErr_Occurred())
+        {
+            throw nb::python_error();
+        }
+        SparrowArray result(std::move(arr));
+        if (align)
+        {
+            result.realign();
+        }
+        return result;
+    }
+
+    std::vector<SparrowArray> import_arrays_from_capsules(const nb::sequence& capsule_pairs)
+    {
+        std::vector<std::pair<PyObject*, PyObject*>> pairs;
+        pairs.reserve(nb::len(capsule_pairs));
+        for (nb::handle item : capsule_pairs)
+        {
+            if (!nb::isinstance<nb::tuple>(item) || nb::len(item) != 2)
+            {
+                throw nb::type_error("import_arrays_from_capsules expects a sequence of (schema, array) tuples");
+            }
+            auto pair = nb::borrow<nb::tuple>(item);
+            // The borrowed pointers stay valid: `capsule_pairs` keeps the tuples alive
+            pairs.emplace_back(pair[0].ptr(), pair[1].ptr());
+        }
+
+        std::optional<std::vector<sparrow::array>> arrays = sparrow::rockfinch::import_arrays_from_capsules(pairs);
+        if (!arrays.has_value())
         {
-            return std::move(*result);
+            throw nb::python_error();
         }
 
-        throw nb::type_error(
-            ("Unsupported ndarray dtype for SparrowArray.from_ndarray(): "
-             + std::string(numpy_dtype_to_string(dtype))
-             + ". Supported dtypes are bool, int8/16/32/64, uint8/16/32/64, float32, and float64.")
-                .c_str()
-        );
+        std::vector<SparrowArray> result;
+        result.reserve(arrays->size());
+        for (auto& arr : *arrays)
+        {
+            result.emplace_back(std::move(arr));
+        }
+        return result;
     }
 
-    nb::object mark_numpy_array_readonly(nb::object array)
+    nb::tuple sparrow_array_to_arrow(const SparrowArray& self, nb::object requested_schema)
     {
-        array.attr("setflags")(false);
-        return array;
+        auto [schema, array] = self.export_to_capsules(requested_schema.ptr());
+        if (schema == nullptr || array == nullptr)
+        {
+            throw nb::python_error();
+        }
+        return nb::make_tuple(nb::steal(schema), nb::steal(array));
     }
 
-    nb::object
-    make_python_memory_view(const void* data, Py_ssize_t len, nb::handle owner, bool readonly)
+    nb::tuple
+    sparrow_array_to_device_array(const SparrowArray& self, nb::object requested_schema, const nb::kwargs& kwargs)
     {
-        Py_buffer view;
-        if (PyBuffer_FillInfo(
-                &view,
-                owner.ptr(),
-                const_cast<void*>(data),
-                len,
-                readonly ? 1 : 0,
-                readonly ? PyBUF_CONTIG_RO : PyBUF_CONTIG
-            )
-            != 0)
+        validate_device_export_kwargs(kwargs);
+        auto [schema, device_array] = self.export_to_device_capsules(requested_schema.ptr());
+        if (schema == nullptr || device_array == nullptr)
         {
             throw nb::python_error();
         }
+        return nb::make_tuple(nb::steal(schema), nb::steal(device_array));
+    }
 
-        PyObject* memory_view = PyMemoryView_FromBuffer(&view);
-        PyBuffer_Release(&view);
-        if (memory_view == nullptr)
+    nb::object sparrow_array_to_schema(const SparrowArray& self)
+    {
+        PyObject* capsule = self.export_schema_to_capsule();
+        if (capsule == nullptr)
         {
             throw nb::python_error();
         }
-        return nb::steal(memory_view);
+        return nb::steal(capsule);
     }
 
-    sparrow::dynamic_bitset_view<std::uint8_t>
-    make_arrow_bitset_view(const void* buffer, std::size_t size, std::size_t offset)
+    namespace
     {
-        return {const_cast<std::uint8_t*>(static_cast<const std::uint8_t*>(buffer)), size, offset};
-    }
+        // Capsule names of the managed tensors, before and after a consumer takes them
+        template <typename Managed>
+        struct dlpack_capsule_names;
 
-    bool parse_copy_argument(const nb::object& copy_arg)
-    {
-        if (copy_arg.is_none())
+        template <>
+        struct dlpack_capsule_names<DLManagedTensor>
         {
-            return false;
-        }
+            static constexpr const char* fresh = "dltensor";
+            static constexpr const char* used = "used_dltensor";
+        };
 
-        if (!nb::isinstance<nb::bool_>(copy_arg))
+        template <>
+        struct dlpack_capsule_names<DLManagedTensorVersioned>
         {
-            throw nb::type_error("__array__(copy=...) only accepts True, False, or None");
-        }
+            static constexpr const char* fresh = "dltensor_versioned";
+            static constexpr const char* used = "used_dltensor_versioned";
+        };
 
-        return nb::cast<bool>(copy_arg);
-    }
+        // What an exported tensor points to: the buffers of the array, held like
+        // those of the NumPy views, or a copy of its values
+        struct dlpack_export_context
+        {
+            std::shared_ptr<const void> buffers;
+            aligned_buffer copy;
+            std::array<std::int64_t, 2> shape{};
+            std::array<std::int64_t, 2> strides{};
+        };
 
-    void validate_numpy_export_supported(const sparrow::array& array)
-    {
-        if (array.null_count() == 0)
+        template <typename Managed>
+        void delete_exported_dlpack_tensor(Managed* managed) noexcept
         {
-            return;
+            // Consumers may call the deleter from any thread, and the buffers can
+            // hold Python objects; they are leaked once the interpreter is gone
+            if (Py_IsInitialized() == 0)
+            {
+                return;
+            }
+            const PyGILState_STATE state = PyGILState_Ensure();
+            delete static_cast<dlpack_export_context*>(managed->manager_ctx);
+            delete managed;
+            PyGILState_Release(state);
         }
 
-        switch (array.data_type())
+        template <typename Managed>
+        void release_unconsumed_dlpack_capsule(PyObject* capsule) noexcept
         {
-            case sparrow::data_type::FLOAT:
-            case sparrow::data_type::DOUBLE:
-                return;
-            case sparrow::data_type::BOOL:
-                throw nb::type_error("SparrowArray.to_numpy() does not support nullable bool arrays");
-            case sparrow::data_type::INT8:
-            case sparrow::data_type::UINT8:
-            case sparrow::data_type::INT16:
-            case sparrow::data_type::UINT16:
-            case sparrow::data_type::INT32:
-            case sparrow::data_type::UINT32:
-            case sparrow::data_type::INT64:
-            case sparrow::data_type::UINT64:
-                throw nb::type_error("SparrowArray.to_numpy() does not support nullable integer arrays");
-            default:
-                return;
+            // Consumers rename the capsules whose tensor they own
+            if (PyCapsule_IsValid(capsule, dlpack_capsule_names<Managed>::fresh) != 0)
+            {
+                auto* managed = static_cast<Managed*>(
+                    PyCapsule_GetPointer(capsule, dlpack_capsule_names<Managed>::fresh)
+                );
+                managed->deleter(managed);
+            }
         }
-    }
 
-    nb::object sparrow_array_to_numpy(SparrowArray& self, bool copy)
-    {
-        auto owner = nb::find(self);
-        if (!owner.is_valid())
+        template <typename Managed>
+        nb::object
+        make_dlpack_capsule(std::unique_ptr<dlpack_export_context> context, const DLTensor& tensor, std::uint64_t flags)
         {
-            throw nb::type_error("Could not resolve Python owner for SparrowArray");
+            auto managed = std::make_unique<Managed>();
+            if constexpr (std::same_as<Managed, DLManagedTensorVersioned>)
+            {
+                managed->version = DLPackVersion{1, 0};
+                managed->flags = flags;
+            }
+            managed->dl_tensor = tensor;
+            managed->dl_tensor.shape = context->shape.data();
+            managed->dl_tensor.strides = context->strides.data();
+            managed->manager_ctx = context.get();
+            managed->deleter = &delete_exported_dlpack_tensor<Managed>;
+            PyObject* capsule = PyCapsule_New(
+                managed.get(),
+                dlpack_capsule_names<Managed>::fresh,
+                &release_unconsumed_dlpack_capsule<Managed>
+            );
+            if (capsule == nullptr)
+            {
+                throw nb::python_error();
+            }
+            context.release();
+            managed.release();
+            return nb::steal(capsule);
         }
 
-        auto& array = self.get_array();
-        auto* arrow_array = sparrow::get_arrow_array(array);
-        validate_numpy_export_supported(array);
+        // DLPack type of the values of an Arrow format, if it has one
+        std::optional<DLDataType> dlpack_dtype_of(const char* format)
+        {
+            const auto make = [](DLDataTypeCode code, std::uint8_t bits)
+            {
+                return DLDataType{static_cast<std::uint8_t>(code), bits, 1};
+            };
+            switch (sparrow::format_to_data_type(format))
+            {
+                case sparrow::data_type::BOOL:
+                    return make(kDLBool, 8);
+                case sparrow::data_type::INT8:
+                    return make(kDLInt, 8);
+                case sparrow::data_type::UINT8:
+                    return make(kDLUInt, 8);
+                case sparrow::data_type::INT16:
+                    return make(kDLInt, 16);
+                case sparrow::data_type::UINT16:
+                    return make(kDLUInt, 16);
+                case sparrow::data_type::INT32:
+                    return make(kDLInt, 32);
+                case sparrow::data_type::UINT32:
+                    return make(kDLUInt, 32);
+                case sparrow::data_type::INT64:
+                    return make(kDLInt, 64);
+                case sparrow::data_type::UINT64:
+                    return make(kDLUInt, 64);
+                case sparrow::data_type::HALF_FLOAT:
+                    return make(kDLFloat, 16);
+                case sparrow::data_type::FLOAT:
+                    return make(kDLFloat, 32);
+                case sparrow::data_type::DOUBLE:
+                    return make(kDLFloat, 64);
+                default:
+                    return std::nullopt;
+            }
+        }
 
-        if (!copy && self.numpy_owner() != nullptr)
+        // Arrow format of the values of a DLPack type, empty if not supported
+        std::string_view arrow_format_of_dlpack(const DLDataType& dtype) noexcept
         {
-            return nb::borrow<nb::object>(self.numpy_owner());
+            if (dtype.lanes != 1)
+            {
+                return {};
+            }
+            switch (dtype.code)
+            {
+                case kDLBool:
+                    return dtype.bits == 8 ? "b" : "";
+                case kDLInt:
+                    switch (dtype.bits)
+                    {
+                        case 8:
+                            return arrow_format_for<std::int8_t>();
+                        case 16:
+                            return arrow_format_for<std::int16_t>();
+                        case 32:
+                            return arrow_format_for<std::int32_t>();
+                        case 64:
+                            return arrow_format_for<std::int64_t>();
+                        default:
+                            return {};
+                    }
+                case kDLUInt:
+                    switch (dtype.bits)
+                    {
+                        case 8:
+                            return arrow_format_for<std::uint8_t>();
+                        case 16:
+                            return arrow_format_for<std::uint16_t>();
+                        case 32:
+                            return arrow_format_for<std::uint32_t>();
+                        case 64:
+                            return arrow_format_for<std::uint64_t>();
+                        default:
+                            return {};
+                    }
+                case kDLFloat:
+                    switch (dtype.bits)
+                    {
+                        case 16:
+                            return arrow_format_for<sparrow::float16_t>();
+                        case 32:
+                            return arrow_format_for<float>();
+                        case 64:
+                            return arrow_format_for<double>();
+                        default:
+                            return {};
+                    }
+                default:
+                    return {};
+            }
         }
 
-        switch (array.data_type())
+        // Take the tensor of an unconsumed capsule; the returned capsule owns it and
+        // calls its deleter when destroyed
+        template <typename Managed>
+        std::pair<nb::object, Managed*> consume_dlpack_capsule(nb::handle capsule)
         {
-            case sparrow::data_type::BOOL:
-                return make_numpy_copy<bool>(
-                    array.size(),
-                    [&](bool* out)
+            auto* managed = static_cast<Managed*>(PyCapsule_GetPointer(capsule.ptr(), dlpack_capsule_names<Managed>::fresh));
+            if (managed == nullptr)
+            {
+                throw nb::python_error();
+            }
+            if constexpr (std::same_as<Managed, DLManagedTensorVersioned>)
+            {
+                // Left to the producer, which still owns the tensor
+                if (managed->version.major != 1)
+                {
+                    throw nb::buffer_error("SparrowArray.from_dlpack() only supports DLPack 1.x tensors");
+                }
+            }
+            if (PyCapsule_SetName(capsule.ptr(), dlpack_capsule_names<Managed>::used) != 0)
+            {
+                throw nb::python_error();
+            }
+            try
+            {
+                nb::capsule owner(
+                    managed,
+                    [](void* ptr) noexcept
                     {
-                        const auto bitset = make_arrow_bitset_view(
-                            arrow_array->buffers[1],
-                            array.size(),
-                            static_cast<std::size_t>(arrow_array->offset)
-                        );
-                        for (std::size_t i = 0; i < array.size(); ++i)
+                        auto* tensor = static_cast<Managed*>(ptr);
+                        if (tensor->deleter != nullptr)
                         {
-                            out[i] = bitset.test(i);
+                            tensor->deleter(tensor);
                         }
-                    },
-                    !copy
+                    }
                 );
-            case sparrow::data_type::INT8:
-                return make_numpy_from_arrow_buffer<std::int8_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::UINT8:
-                return make_numpy_from_arrow_buffer<std::uint8_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::INT16:
-                return make_numpy_from_arrow_buffer<std::int16_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::UINT16:
-                return make_numpy_from_arrow_buffer<std::uint16_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::INT32:
-                return make_numpy_from_arrow_buffer<std::int32_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::UINT32:
-                return make_numpy_from_arrow_buffer<std::uint32_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::INT64:
-                return make_numpy_from_arrow_buffer<std::int64_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::UINT64:
-                return make_numpy_from_arrow_buffer<std::uint64_t>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::FLOAT:
-                return make_numpy_from_arrow_buffer<float>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::DOUBLE:
-                return make_numpy_from_arrow_buffer<double>(arrow_array, array.size(), owner, copy);
-            case sparrow::data_type::HALF_FLOAT:
-                throw nb::type_error("SparrowArray.to_numpy() does not yet support float16 arrays");
-            default:
-                throw nb::type_error("SparrowArray.to_numpy() only supports primitive 1D Sparrow arrays");
+                return {std::move(owner), managed};
+            }
+            catch (...)
+            {
+                if (managed->deleter != nullptr)
+                {
+                    managed->deleter(managed);
+                }
+                throw;
+            }
         }
-    }
-
-    nb::object sparrow_array_dunder_array(SparrowArray& self, nb::object dtype, nb::object copy)
-    {
-        nb::object result = sparrow_array_to_numpy(self, parse_copy_argument(copy));
 
-        if (!dtype.is_none())
+        // Import a 1-D tensor, or a 2-D one as fixed-size lists; *owner* keeps it alive
+        SparrowArray import_dlpack_tensor(const DLTensor& tensor, const nb::object& owner, bool writable, bool align)
         {
-            nb::module_ numpy = nb::module_::import_("numpy");
-            nb::object requested_dtype = numpy.attr("dtype")(dtype);
-            nb::object native_dtype = result.attr("dtype");
+            if (tensor.device.device_type != kDLCPU)
+            {
+                throw nb::buffer_error("SparrowArray.from_dlpack() only supports tensors on the CPU device");
+            }
+            if (tensor.ndim != 1 && tensor.ndim != 2)
+            {
+                throw nb::value_error("SparrowArray.from_dlpack() only supports 1D and 2D tensors");
+            }
+            const std::string_view format = arrow_format_of_dlpack(tensor.dtype);
+            if (format.empty())
+            {
+                throw nb::type_error(
+                    ("Unsupported DLPack dtype for SparrowArray.from_dlpack(): code "
+                     + std::to_string(tensor.dtype.code) + ", " + std::to_string(tensor.dtype.bits) + " bits, "
+                     + std::to_string(tensor.dtype.lanes)
+                     + " lanes. Supported dtypes are bool, int8/16/32/64, uint8/16/32/64, float16, float32 "
+                       "and float64.")
+                        .c_str()
+                );
+            }
 
-            if (!python_objects_equal(requested_dtype, native_dtype))
+            const std::int64_t length = tensor.shape[0];
+            const std::int64_t width = tensor.ndim == 2 ? tensor.shape[1] : 1;
+            if (width == 0)
             {
-                throw nb::type_error("SparrowArray.__array__() does not support dtype conversion requests");
+                throw nb::value_error("SparrowArray.from_dlpack() requires 2D tensors with at least one column");
             }
-        }
+            // In elements; no strides means C-contiguous
+            const std::int64_t length_stride = tensor.strides != nullptr ? tensor.strides[0] : width;
+            const std::int64_t width_stride = tensor.ndim == 2 && tensor.strides != nullptr ? tensor.strides[1] : 1;
+            const bool contiguous = (length <= 1 || length_stride == width) && (width <= 1 || width_stride == 1);
+            const auto size = static_cast<std::size_t>(length * width);
+            const auto item_size = static_cast<std::ptrdiff_t>(tensor.dtype.bits / 8);
+            const auto* data = static_cast<const std::byte*>(tensor.data) + tensor.byte_offset;
 
-        return result;
+            aligned_buffer gathered;
+            if (!contiguous)
+            {
+                gathered = make_aligned_buffer(size * static_cast<std::size_t>(item_size));
+                std::optional<nb::gil_scoped_release> released;
+                if (size * static_cast<std::size_t>(item_size) >= parallel_gather_min_bytes)
+                {
+                    released.emplace();
+                }
+                if (tensor.ndim == 1)
+                {
+                    gather_strided(data, length_stride * item_size, static_cast<std::size_t>(item_size), size, gathered.get());
+                }
+                else
+                {
+                    for (std::int64_t row = 0; row < length; ++row)
+                    {
+                        gather_strided(
+                            data + row * length_stride * item_size,
+                            width_stride * item_size,
+                            static_cast<std::size_t>(item_size),
+                            static_cast<std::size_t>(width),
+                            gathered.get() + row * width * item_size
+                        );
+                    }
+                }
+            }
+
+            SparrowArray values = [&]() -> SparrowArray
+            {
+                if (format == "b")
+                {
+                    // DLPack bools are bytes: packed into a new bitmap
+                    const void* bytes = contiguous ? static_cast<const void*>(data) : gathered.get();
+                    return sparrow_array_from_aligned_buffer(pack_numpy_bools(bytes, size, false).first, size, "b");
+                }
+                if (!contiguous)
+                {
+                    // Gathered into a freshly allocated buffer: already aligned
+                    return sparrow_array_from_aligned_buffer(std::move(gathered), size, format);
+                }
+                SparrowArray borrowed = sparrow_array_from_borrowed_buffer(data, size, format, owner, writable);
+                if (align)
+                {
+                    borrowed.realign();
+                }
+                return borrowed;
+            }();
+            if (tensor.ndim == 1)
+            {
+                return values;
+            }
+            return SparrowArray(sparrow::array(
+                sparrow::fixed_sized_list_array(static_cast<std::uint64_t>(width), std::move(values.get_array()), false)
+            ));
+        }
     }
 
-    SparrowArray sparrow_array_from_arrow(const nb::object& arrow_array)
+    nb::object sparrow_array_to_dlpack(
+        SparrowArray& self,
+        const nb::object& stream,
+        const nb::object& max_version,
+        const nb::object& dl_device,
+        const nb::object& copy
+    )
     {
-        if (!nb::hasattr(arrow_array, "__arrow_c_array__"))
+        if (!stream.is_none())
+        {
+            throw nb::value_error("SparrowArray.__dlpack__() only accepts stream=None for CPU data");
+        }
+        if (!dl_device.is_none() && nb::cast<std::pair<int, int>>(dl_device) != std::pair<int, int>{kDLCPU, 0})
+        {
+            throw nb::buffer_error("SparrowArray.__dlpack__() only exports to the CPU device");
+        }
+        if (!copy.is_none() && !nb::isinstance<nb::bool_>(copy))
+        {
+            throw nb::type_error("__dlpack__(copy=...) only accepts True, False, or None");
+        }
+        const std::optional<bool> copy_mode = copy.is_none() ? std::nullopt : std::optional(nb::cast<bool>(copy));
+        const bool versioned = !max_version.is_none() && nb::cast<std::pair<int, int>>(max_version).first >= 1;
+
+        const auto& source = std::as_const(self).get_array();
+        if (sparrow::get_arrow_array(source)->dictionary != nullptr)
+        {
+            throw nb::type_error("SparrowArray.__dlpack__() does not support dictionary-encoded arrays");
+        }
+        if (source.null_count() != 0)
+        {
+            throw nb::type_error("SparrowArray.__dlpack__() does not support arrays with nulls");
+        }
+        const bool is_list = source.data_type() == sparrow::data_type::FIXED_SIZED_LIST;
+        const ArrowSchema* values_schema = sparrow::get_arrow_schema(source);
+        if (is_list)
+        {
+            values_schema = values_schema->children[0];
+            if (sparrow::get_arrow_array(source)->children[0]->null_count != 0)
+            {
+                throw nb::type_error("SparrowArray.__dlpack__() does not support fixed-size lists with nulls");
+            }
+        }
+        const std::optional<DLDataType> dtype = dlpack_dtype_of(values_schema->format);
+        if (!dtype.has_value())
         {
             throw nb::type_error(
-                "Input object must implement __arrow_c_array__ (ArrowArrayExportable protocol)"
+                "SparrowArray.__dlpack__() only supports bool and numeric 1D Sparrow arrays and fixed-size lists of them"
+            );
+        }
+
+        // Bit-packed bools are always unpacked into a copy
+        const bool is_bool = dtype->code == kDLBool;
+        if (is_bool && copy_mode == false)
+        {
+            throw nb::buffer_error("SparrowArray.__dlpack__(copy=False) cannot export bool arrays, stored bit-packed");
+        }
+        const bool writable_source = self.numpy_owner() != nullptr && self.numpy_owner_writable();
+        // Tensors before DLPack 1.0 cannot be flagged read-only and the consumer
+        // may write to them, so they get a private copy of read-only buffers
+        const bool legacy_copy = !versioned && !writable_source;
+        if (legacy_copy && copy_mode == false)
+        {
+            throw nb::buffer_error(
+                "SparrowArray.__dlpack__(copy=False) requires max_version >= (1, 0) to export read-only buffers"
             );
         }
+        // As for the Arrow exports, buffers a live writable view may change are copied
+        if (self.has_writable_view() && copy_mode == false)
+        {
+            throw nb::buffer_error("SparrowArray.__dlpack__(copy=False) cannot export buffers of a live writable view");
+        }
+        const bool copy_values = is_bool || copy_mode == true || legacy_copy || self.has_writable_view();
 
-        nb::object capsules = arrow_array.attr("__arrow_c_array__")();
+        const auto& array = std::as_const(self).get_array();
+        const ArrowArray* values = sparrow::get_arrow_array(array);
+        std::int64_t offset = values->offset;
+        std::int64_t list_size = 1;
+        if (is_list)
+        {
+            // Format "+w:<list_size>"
+            list_size = std::strtoll(sparrow::get_arrow_schema(array)->format + 3, nullptr, 10);
+            values = values->children[0];
+            offset = values->offset + offset * list_size;
+        }
+        const auto length = static_cast<std::int64_t>(array.size());
+        const auto size = static_cast<std::size_t>(length * list_size);
+        const std::size_t item_size = dtype->bits / 8;
 
-        if (!nb::isinstance<nb::tuple>(capsules) || nb::len(capsules) != 2)
+        auto context = std::make_unique<dlpack_export_context>();
+        const std::byte* data = nullptr;
+        if (is_bool)
+        {
+            context->copy = make_aligned_buffer(size);
+            unpack_bits(
+                static_cast<const std::uint8_t*>(values->buffers[1]),
+                static_cast<std::size_t>(offset),
+                size,
+                reinterpret_cast<bool*>(context->copy.get()),
+                false
+            );
+            data = context->copy.get();
+        }
+        else
+        {
+            data = static_cast<const std::byte*>(values->buffers[1]) + static_cast<std::size_t>(offset) * item_size;
+            if (copy_values)
+            {
+                context->copy = make_aligned_buffer(size * item_size);
+                std::copy_n(data, size * item_size, context->copy.get());
+                data = context->copy.get();
+            }
+            else
+            {
+                context->buffers = self.owner();
+            }
+        }
+
+        DLTensor tensor{};
+        tensor.data = const_cast<std::byte*>(data);
+        tensor.device = DLDevice{kDLCPU, 0};
+        tensor.ndim = is_list ? 2 : 1;
+        tensor.dtype = *dtype;
+        tensor.byte_offset = 0;
+        if (is_list)
+        {
+            context->shape = {length, list_size};
+            context->strides = {list_size, 1};
+        }
+        else
         {
-            throw nb::type_error("__arrow_c_array__ must return a tuple of 2 elements");
+            context->shape = {length, 0};
+            context->strides = {1, 0};
         }
 
-        auto capsule_tuple = nb::cast<nb::tuple>(capsules);
-        return {capsule_tuple[0].ptr(), capsule_tuple[1].ptr()};
+        if (!versioned)
+        {
+            return make_dlpack_capsule<DLManagedTensor>(std::move(context), tensor, 0);
+        }
+        std::uint64_t flags = 0;
+        if (copy_values)
+        {
+            flags |= DLPACK_FLAG_BITMASK_IS_COPIED;
+        }
+        else if (!writable_source)
+        {
+            flags |= DLPACK_FLAG_BITMASK_READ_ONLY;
+        }
+        return make_dlpack_capsule<DLManagedTensorVersioned>(std::move(context), tensor, flags);
     }
 
-    nb::tuple sparrow_array_to_arrow(const SparrowArray& self, nb::object /*requested_schema*/)
+    nb::tuple sparrow_array_dlpack_device(const SparrowArray&)
     {
-        auto [schema, array] = self.export_to_capsules();
-        return nb::make_tuple(nb::steal(schema), nb::steal(array));
+        return nb::make_tuple(static_cast<int>(kDLCPU), 0);
     }
 
-    nb::object sparrow_array_to_schema(const SparrowArray& self)
+    SparrowArray sparrow_array_from_dlpack(const nb::object& tensor, bool align)
     {
-        PyObject* capsule = self.export_schema_to_capsule();
-        if (capsule == nullptr)
+        nb::object capsule = tensor;
+        if (PyCapsule_CheckExact(tensor.ptr()) == 0)
         {
-            throw nb::python_error();
+            if (!nb::hasattr(tensor, "__dlpack__"))
+            {
+                throw nb::type_error("SparrowArray.from_dlpack() requires an object implementing __dlpack__");
+            }
+            if (nb::hasattr(tensor, "__dlpack_device__")
+                && nb::cast<std::pair<int, int>>(tensor.attr("__dlpack_device__")()).first != kDLCPU)
+            {
+                throw nb::buffer_error("SparrowArray.from_dlpack() only supports tensors on the CPU device");
+            }
+            try
+            {
+                capsule = tensor.attr("__dlpack__")(nb::arg("max_version") = nb::make_tuple(1, 0));
+            }
+            catch (nb::python_error& e)
+            {
+                // Producers older than DLPack 1.0 do not take max_version
+                if (!e.matches(PyExc_TypeError))
+                {
+                    throw;
+                }
+                capsule = tensor.attr("__dlpack__")();
+            }
         }
-        return nb::steal(capsule);
-    }
 
+        if (PyCapsule_IsValid(capsule.ptr(), dlpack_capsule_names<DLManagedTensorVersioned>::fresh) != 0)
+        {
+            auto [owner, managed] = consume_dlpack_capsule<DLManagedTensorVersioned>(capsule);
+            const bool writable = (managed->flags & DLPACK_FLAG_BITMASK_READ_ONLY) == 0;
+            return import_dlpack_tensor(managed->dl_tensor, owner, writable, align);
+        }
+        if (PyCapsule_IsValid(capsule.ptr(), dlpack_capsule_names<DLManagedTensor>::fresh) != 0)
+        {
+            auto [owner, managed] = consume_dlpack_capsule<DLManagedTensor>(capsule);
+            return import_dlpack_tensor(managed->dl_tensor, owner, true, align);
+        }
+        throw nb::type_error("SparrowArray.from_dlpack() requires an unconsumed DLPack capsule");
+    }
 }  // namespace sparrow::rockfinch::detail
 
 namespace sparrow::rockfinch
 {
+    void validate_device_export_kwargs(const nb::kwargs& kwargs)
+    {
+        for (auto [key, value] : kwargs)
+        {
+            if (!value.is_none())
+            {
+                PyErr_Format(
+                    PyExc_NotImplementedError,
+                    "Unsupported keyword argument '%U'",
+                    key.ptr()
+                );
+                throw nb::python_error();
+            }
+        }
+    }
+
+    validation_mode parse_validation_mode(std::string_view mode)
+    {
+        if (mode == "trusted")
+        {
+            return validation_mode::trusted;
+        }
+        if (mode == "full")
+        {
+            return validation_mode::full;
+        }
+        throw nb::value_error("validate must be 'trusted' or 'full'");
+    }
+
     void register_sparrow_array(nb::module_& m) noexcept
     {
         nb::class_<SparrowArray>(
@@ -413,11 +2185,30 @@ namespace sparrow::rockfinch
                 "from_arrow",
                 &detail::sparrow_array_from_arrow,
                 nb::arg("arrow_array"),
+                nb::arg("lazy") = false,
+                nb::arg("validate") = "trusted",
+                nb::arg("align") = false,
                 "Create a SparrowArray from an Arrow-compatible object.\n\n"
                 "Parameters\n"
                 "----------\n"
                 "arrow_array : ArrowArrayExportable\n"
-                "    An object implementing __arrow_c_array__ (e.g., PyArrow array).\n\n"
+                "    An object implementing __arrow_c_array__ (e.g., PyArrow array),\n"
+                "    or __arrow_c_device_array__ with data in CPU memory.\n"
+                "lazy : bool, default False\n"
+                "    Keep the imported Arrow structures as-is and only build the\n"
+                "    typed array on first use (e.g. to_numpy). len(), the schema\n"
+                "    and re-exporting through the PyCapsule Interface do not\n"
+                "    trigger it, which makes forwarding arrays cheaper.\n"
+                "validate : {'trusted', 'full'}, default 'trusted'\n"
+                "    'trusted' imports the data as-is. 'full' first checks the\n"
+                "    buffer and child counts, null counts, offsets, UTF-8 strings\n"
+                "    and dictionary indices, and raises ValueError on malformed\n"
+                "    input from an untrusted producer.\n"
+                "align : bool, default False\n"
+                "    Copy the buffers that are not 64-byte aligned, or that start\n"
+                "    before the data because of a non-zero offset, so that every\n"
+                "    buffer suits aligned SIMD loads. Aligned buffers are shared,\n"
+                "    not copied. See realign_stats().\n\n"
                 "Returns\n"
                 "-------\n"
                 "SparrowArray\n"
@@ -427,18 +2218,65 @@ namespace sparrow::rockfinch
                 "from_ndarray",
                 &detail::sparrow_array_from_ndarray,
                 nb::arg("array"),
-                "Create a SparrowArray from a 1D contiguous NumPy ndarray.\n\n"
+                nb::arg("align") = false,
+                nb::arg("mask") = nb::none(),
+                nb::arg("null_sentinel") = nb::none(),
+                "Create a SparrowArray from a 1D or 2D NumPy ndarray.\n\n"
                 "Supported dtypes are bool, int8/16/32/64, uint8/16/32/64,\n"
-                "float32, and float64.\n\n"
+                "float16, float32, and float64. Contiguous numeric ndarrays are shared\n"
+                "(zero-copy); strided ones, including reversed and broadcast\n"
+                "views, are gathered into a new aligned buffer.\n\n"
+                "datetime64 and timedelta64 with unit s, ms, us or ns are shared\n"
+                "as Arrow timestamps and durations, and datetime64[D] is copied as\n"
+                "date32. NaT values become nulls.\n\n"
+                "An (N, K) ndarray becomes N fixed_size_list<T>[K] values whose\n"
+                "child holds the flattened rows: a C-contiguous one is shared,\n"
+                "other layouts are made C-contiguous with numpy.ascontiguousarray\n"
+                "first, and ndarrays without columns are rejected. Use\n"
+                "SparrowRecordBatch.from_ndarray to import the columns instead.\n\n"
+                "Nulls of 1D arrays can also come from a numpy.ma.MaskedArray, mask\n"
+                "or null_sentinel. They become an Arrow validity bitmap; the values\n"
+                "are still shared.\n\n"
                 "Parameters\n"
                 "----------\n"
                 "array : numpy.ndarray\n"
-                "    A contiguous 1D ndarray on CPU memory.\n\n"
+                "    A 1D or 2D ndarray on CPU memory.\n"
+                "align : bool, default False\n"
+                "    Copy the data if it is not 64-byte aligned.\n"
+                "mask : array_like of bool, optional\n"
+                "    True for the nulls. Not allowed for a MaskedArray, which\n"
+                "    brings its own mask.\n"
+                "null_sentinel : scalar, optional\n"
+                "    The value of the nulls, e.g. float('nan') (which matches any\n"
+                "    NaN) or -1. Not allowed together with a mask.\n\n"
                 "Returns\n"
                 "-------\n"
                 "SparrowArray\n"
                 "    A new SparrowArray containing the ndarray data."
             )
+            .def_static(
+                "from_dlpack",
+                &detail::sparrow_array_from_dlpack,
+                nb::arg("tensor"),
+                nb::arg("align") = false,
+                "Create a SparrowArray from a DLPack tensor on the CPU.\n\n"
+                "Accepts any object implementing __dlpack__ (e.g. a PyTorch or JAX\n"
+                "CPU tensor, or a NumPy ndarray) or a DLPack capsule. Supported dtypes\n"
+                "are bool, int8/16/32/64, uint8/16/32/64, float16, float32 and\n"
+                "float64. Contiguous numeric tensors are shared (zero-copy) and kept\n"
+                "alive by the array; strided ones are gathered into a new aligned\n"
+                "buffer and bools are packed. 2D tensors become fixed-size lists.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "tensor : object\n"
+                "    A 1D or 2D tensor implementing the DLPack protocol.\n"
+                "align : bool, default False\n"
+                "    Copy the data if it is not 64-byte aligned.\n\n"
+                "Returns\n"
+                "-------\n"
+                "SparrowArray\n"
+                "    A new SparrowArray containing the tensor data."
+            )
             .def(
                 "__arrow_c_array__",
                 &detail::sparrow_array_to_arrow,
@@ -448,12 +2286,35 @@ namespace sparrow::rockfinch
                 "----------\n"
                 "requested_schema : object, optional\n"
                 "    A PyCapsule containing an ArrowSchema for requested format.\n"
-                "    Currently ignored (best-effort conversion not implemented).\n\n"
+                "    When it differs from the array layout, the array is cast\n"
+                "    (numeric widening/narrowing, utf8 <-> large_utf8, binary <->\n"
+                "    large_binary, struct fields). If the cast is not possible,\n"
+                "    the native layout is exported.\n\n"
                 "Returns\n"
                 "-------\n"
                 "tuple[object, object]\n"
                 "    A tuple of (schema_capsule, array_capsule)."
             )
+            .def(
+                "__arrow_c_device_array__",
+                &detail::sparrow_array_to_device_array,
+                nb::arg("requested_schema") = nb::none(),
+                nb::arg("kwargs"),
+                "Export the array via the Arrow PyCapsule interface for device data.\n\n"
+                "The data always lives in CPU memory (ARROW_DEVICE_CPU) and is shared\n"
+                "without copy, as with __arrow_c_array__.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "requested_schema : object, optional\n"
+                "    A PyCapsule containing an ArrowSchema for requested format,\n"
+                "    handled as in __arrow_c_array__.\n"
+                "**kwargs\n"
+                "    Reserved by the protocol; non-None values raise NotImplementedError.\n\n"
+                "Returns\n"
+                "-------\n"
+                "tuple[object, object]\n"
+                "    A tuple of (schema_capsule, device_array_capsule)."
+            )
             .def(
                 "__arrow_c_schema__",
                 &detail::sparrow_array_to_schema,
@@ -465,12 +2326,59 @@ namespace sparrow::rockfinch
             )
             .def(
                 "to_numpy",
-                &detail::sparrow_array_to_numpy,
+                &detail::sparrow_array_to_numpy_method,
                 nb::arg("copy") = false,
+                nb::arg("nulls") = nb::none(),
+                nb::arg("fill_value") = nb::none(),
+                nb::arg("writable") = false,
+                nb::arg("dictionary") = nb::none(),
                 "Export the array as a NumPy ndarray.\n\n"
                 "Primitive numeric arrays export as zero-copy views when possible.\n"
                 "Bool arrays export via copy because Sparrow stores them bit-packed.\n"
-                "Nullable float arrays export via copy using NaN sentinels for nulls.\n"
+                "Nullable float16/32/64 arrays export via copy using NaN sentinels\n"
+                "for nulls.\n\n"
+                "Timestamps and durations export as datetime64 and timedelta64 of\n"
+                "the same unit, date64 as datetime64[ms] and date32 as a\n"
+                "datetime64[D] copy; nulls become NaT.\n\n"
+                "Strings export as a StringDType copy on NumPy 2 (an object array of\n"
+                "str before) and binaries as an object array of bytes; nulls become\n"
+                "None.\n\n"
+                "Fixed-size lists of K numeric values, e.g. imported from an (N, K)\n"
+                "ndarray, export as an (N, K) ndarray, a zero-copy view when\n"
+                "possible.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "copy : bool, default False\n"
+                "    Always return a copy of the values.\n"
+                "nulls : {None, 'mask', 'sentinel'}, default None\n"
+                "    None rejects nullable bool and integer arrays. 'mask' returns a\n"
+                "    numpy.ma.MaskedArray whose data is the same array as without\n"
+                "    nulls (a zero-copy view for numeric arrays) and whose mask is\n"
+                "    True for nulls. 'sentinel' returns a copy where the nulls are\n"
+                "    set to fill_value.\n"
+                "fill_value : scalar, optional\n"
+                "    The value of the nulls with nulls='sentinel'.\n"
+                "writable : bool, default False\n"
+                "    Return a writable array. Views are read-only unless this is set.\n"
+                "    The values are then copied once (copy-on-write) unless this\n"
+                "    array is the only owner of its buffers: no copy, view or export\n"
+                "    shares them and they were not borrowed from another producer.\n"
+                "    While the writable array is alive, further writable=True calls\n"
+                "    share its buffers and read-only views see its writes, whereas\n"
+                "    Arrow and DLPack exports get a copy of the current values.\n"
+                "dictionary : {None, 'codes'}, default None\n"
+                "    None rejects dictionary-encoded arrays. 'codes' returns a tuple\n"
+                "    (codes, categories): the indices, a zero-copy view unless they\n"
+                "    have nulls (handled as set by nulls), and the dictionary values,\n"
+                "    exported like a plain array. Nothing is decoded.\n"
+            )
+            .def(
+                "to_categorical",
+                &detail::sparrow_array_to_categorical,
+                "Export a dictionary-encoded array as a pandas.Categorical.\n\n"
+                "The codes and categories come from to_numpy(dictionary='codes'),\n"
+                "with -1 for the nulls, so no value is decoded. The categories are\n"
+                "ordered if the dictionary is. Requires pandas and signed indices.\n"
             )
             .def(
                 "__array__",
@@ -481,7 +2389,65 @@ namespace sparrow::rockfinch
                 "This delegates to to_numpy() and rejects dtype coercions that would\n"
                 "change the exported representation."
             )
+            .def(
+                "__dlpack__",
+                &detail::sparrow_array_to_dlpack,
+                nb::kw_only(),
+                nb::arg("stream") = nb::none(),
+                nb::arg("max_version") = nb::none(),
+                nb::arg("dl_device") = nb::none(),
+                nb::arg("copy") = nb::none(),
+                "Export the array as a DLPack capsule (see numpy.from_dlpack,\n"
+                "torch.from_dlpack).\n\n"
+                "Bool and numeric 1D arrays without nulls export as 1D tensors and\n"
+                "fixed-size lists of them as 2D tensors, sharing the buffers of the\n"
+                "array. Bool arrays are unpacked into a copy. Views are flagged\n"
+                "read-only for DLPack 1.0 consumers; older consumers, which cannot\n"
+                "be told, get a private copy unless the array borrows a writable\n"
+                "NumPy array.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "stream : None\n"
+                "    The data is on the CPU: no stream is supported.\n"
+                "max_version : tuple[int, int], optional\n"
+                "    The highest DLPack version of the consumer; (1, 0) or above\n"
+                "    returns a versioned capsule.\n"
+                "dl_device : tuple[int, int], optional\n"
+                "    Must be the CPU device (1, 0) if given.\n"
+                "copy : bool, optional\n"
+                "    True always copies, False raises BufferError when a copy is\n"
+                "    needed, None copies only when needed."
+            )
+            .def(
+                "__dlpack_device__",
+                &detail::sparrow_array_dlpack_device,
+                "Return the DLPack device of the array: always the CPU, (1, 0)."
+            )
+            .def(
+                "is_materialized",
+                &SparrowArray::is_materialized,
+                "Whether the typed array has been built (always True unless created\n"
+                "with from_arrow(..., lazy=True))."
+            )
             .def("size", &SparrowArray::size, "Get the number of elements in the array.")
             .def("__len__", &SparrowArray::size);
+
+        m.def(
+            "import_arrays_from_capsules",
+            &detail::import_arrays_from_capsules,
+            nb::arg("capsule_pairs"),
+            "Import many arrays from Arrow PyCapsules in a single call.\n\n"
+            "All capsules are validated and every array is built before any capsule\n"
+            "is consumed. Equal schemas are copied once and shared by their arrays.\n\n"
+            "Parameters\n"
+            "----------\n"
+            "capsule_pairs : Sequence[tuple[object, object]]\n"
+            "    (schema_capsule, array_capsule) pairs, e.g. as returned by\n"
+            "    __arrow_c_array__.\n\n"
+            "Returns\n"
+            "-------\n"
+            "list[SparrowArray]\n"
+            "    The imported arrays, in input order."
+        );
     }
 }
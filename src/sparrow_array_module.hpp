@@ -1,8 +1,27 @@
 #pragma once
 
+#include <string_view>
+
 #include <nanobind/nanobind.h>
 
+#include <sparrow-rockfinch/arrow_validate.hpp>
+
 namespace sparrow::rockfinch
 {
     void register_sparrow_array(nanobind::module_& m) noexcept;
+
+    /**
+     * @brief Check the extra keyword arguments of the device PyCapsule protocol methods.
+     *
+     * No keyword is supported yet; as required by the protocol, any keyword
+     * passed with a value other than ``None`` raises ``NotImplementedError``.
+     */
+    void validate_device_export_kwargs(const nanobind::kwargs& kwargs);
+
+    /**
+     * @brief Parse the ``validate`` argument of the import methods.
+     *
+     * @throws nanobind::value_error If @p mode is neither ``"trusted"`` nor ``"full"``.
+     */
+    validation_mode parse_validation_mode(std::string_view mode);
 }
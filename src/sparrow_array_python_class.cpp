@@ -1,21 +1,35 @@
 #include "sparrow-rockfinch/sparrow_array_python_class.hpp"
 
+#include <optional>
 #include <utility>
 
+#include "sparrow-rockfinch/arrow_align.hpp"
+#include "sparrow-rockfinch/arrow_cast.hpp"
+#include "sparrow-rockfinch/detail/lazy_arrow_array.hpp"
+#include "sparrow-rockfinch/detail/shared_arrow_schema.hpp"
+
 namespace sparrow::rockfinch
 {
     SparrowArray::SparrowArray(PyObject* schema_capsule, PyObject* array_capsule)
-        : m_array(import_array_from_capsules(schema_capsule, array_capsule))
+        : m_array(std::make_shared<sparrow::array>(import_array_from_capsules(schema_capsule, array_capsule)))
     {
     }
 
     SparrowArray::SparrowArray(sparrow::array&& arr)
-        : m_array(std::move(arr))
+        : m_array(std::make_shared<sparrow::array>(std::move(arr)))
+    {
+    }
+
+    SparrowArray::SparrowArray(std::shared_ptr<detail::lazy_arrow_array> lazy)
+        : m_lazy(std::move(lazy))
     {
     }
 
     SparrowArray::SparrowArray(const SparrowArray& other)
         : m_array(other.m_array)
+        , m_lazy(other.m_lazy)
+        , m_schema(other.m_schema)
+        , m_writable_view(other.m_writable_view)
         , m_numpy_owner(other.m_numpy_owner)
         , m_numpy_owner_writable(other.m_numpy_owner_writable)
     {
@@ -24,6 +38,9 @@ namespace sparrow::rockfinch
 
     SparrowArray::SparrowArray(SparrowArray&& other) noexcept
         : m_array(std::move(other.m_array))
+        , m_lazy(std::move(other.m_lazy))
+        , m_schema(std::move(other.m_schema))
+        , m_writable_view(std::move(other.m_writable_view))
         , m_numpy_owner(other.m_numpy_owner)
         , m_numpy_owner_writable(other.m_numpy_owner_writable)
     {
@@ -37,6 +54,9 @@ namespace sparrow::rockfinch
         {
             clear_numpy_owner();
             m_array = other.m_array;
+            m_lazy = other.m_lazy;
+            m_schema = other.m_schema;
+            m_writable_view = other.m_writable_view;
             m_numpy_owner = other.m_numpy_owner;
             m_numpy_owner_writable = other.m_numpy_owner_writable;
             Py_XINCREF(m_numpy_owner);
@@ -50,6 +70,9 @@ namespace sparrow::rockfinch
         {
             clear_numpy_owner();
             m_array = std::move(other.m_array);
+            m_lazy = std::move(other.m_lazy);
+            m_schema = std::move(other.m_schema);
+            m_writable_view = std::move(other.m_writable_view);
             m_numpy_owner = other.m_numpy_owner;
             m_numpy_owner_writable = other.m_numpy_owner_writable;
             other.m_numpy_owner = nullptr;
@@ -65,29 +88,80 @@ namespace sparrow::rockfinch
 
     std::pair<PyObject*, PyObject*> SparrowArray::export_to_capsules() const
     {
-        // We need a non-const copy since export moves from the array
-        sparrow::array arr_copy = m_array;
-        return export_array_to_capsules(arr_copy);
+        return export_requested(nullptr, false);
+    }
+
+    std::pair<PyObject*, PyObject*> SparrowArray::export_to_capsules(PyObject* requested_schema) const
+    {
+        return export_requested(requested_schema, false);
+    }
+
+    std::pair<PyObject*, PyObject*> SparrowArray::export_to_device_capsules(PyObject* requested_schema) const
+    {
+        return export_requested(requested_schema, true);
     }
 
     PyObject* SparrowArray::export_schema_to_capsule() const
     {
-        return sparrow::rockfinch::export_schema_to_capsule(m_array);
+        return export_shared_schema_to_capsule(shared_schema());
     }
 
     size_t SparrowArray::size() const
     {
-        return m_array.size();
+        return m_array != nullptr ? m_array->size() : static_cast<size_t>(m_lazy->arrow_array().length);
+    }
+
+    bool SparrowArray::is_materialized() const
+    {
+        return m_array != nullptr;
+    }
+
+    bool SparrowArray::realign()
+    {
+        std::optional<sparrow::array> realigned = realign_array(arrow_array(), shared_schema().schema(), owner());
+        if (!realigned.has_value())
+        {
+            return false;
+        }
+        // The schema is unchanged, so the cached export stays valid. Buffers still
+        // shared with the previous array are kept alive through its structures.
+        m_array = std::make_shared<sparrow::array>(std::move(*realigned));
+        m_lazy.reset();
+        m_writable_view.reset();
+        clear_numpy_owner();
+        return true;
+    }
+
+    bool SparrowArray::make_buffers_exclusive()
+    {
+        materialize();
+        if (m_array.use_count() == 1 && owns_all_buffers(*sparrow::get_arrow_array(*m_array)))
+        {
+            return false;
+        }
+        std::optional<sparrow::array> copied = copy_array(arrow_array(), shared_schema().schema());
+        // The schema is unchanged, so the cached export stays valid. Layouts that
+        // copy_array does not support fall back to a copy by sparrow.
+        m_array = copied.has_value() ? std::make_shared<sparrow::array>(std::move(*copied))
+                                     : std::make_shared<sparrow::array>(*m_array);
+        m_writable_view.reset();
+        clear_numpy_owner();
+        return true;
     }
 
     sparrow::array& SparrowArray::get_array()
     {
-        return m_array;
+        materialize();
+        detach();
+        // The caller may change the schema through the returned reference
+        m_schema.reset();
+        return *m_array;
     }
 
     const sparrow::array& SparrowArray::get_array() const
     {
-        return m_array;
+        materialize();
+        return *m_array;
     }
 
     void SparrowArray::set_numpy_owner(PyObject* owner, bool writable)
@@ -115,4 +189,116 @@ namespace sparrow::rockfinch
         m_numpy_owner_writable = false;
     }
 
+    void SparrowArray::detach()
+    {
+        if (m_array.use_count() > 1)
+        {
+            m_array = std::make_shared<sparrow::array>(*m_array);
+            m_writable_view.reset();
+            clear_numpy_owner();
+        }
+    }
+
+    std::pair<const ArrowArray*, std::shared_ptr<const void>> SparrowArray::export_source() const
+    {
+        if (!has_writable_view())
+        {
+            return {&arrow_array(), owner()};
+        }
+        // A live writable NumPy view may still change the buffers: export a snapshot
+        std::optional<sparrow::array> copied = copy_array(arrow_array(), shared_schema().schema());
+        auto snapshot = copied.has_value() ? std::make_shared<sparrow::array>(std::move(*copied))
+                                           : std::make_shared<sparrow::array>(*m_array);
+        const ArrowArray* source = sparrow::get_arrow_array(*snapshot);
+        return {source, std::move(snapshot)};
+    }
+
+    std::pair<PyObject*, PyObject*> SparrowArray::export_requested(PyObject* requested_schema, bool device) const
+    {
+        const auto exported = export_source();
+        const ArrowArray* source = exported.first;
+        const std::shared_ptr<const void>& source_owner = exported.second;
+        const auto export_native = [&]
+        {
+            return device ? export_shared_array_to_device_capsules(*source, source_owner, shared_schema())
+                          : export_shared_array_to_capsules(*source, source_owner, shared_schema());
+        };
+
+        if (requested_schema == nullptr || requested_schema == Py_None)
+        {
+            return export_native();
+        }
+        const ArrowSchema* requested = get_schema_from_capsule(requested_schema);
+        if (requested == nullptr)
+        {
+            return {nullptr, nullptr};
+        }
+        if (has_same_layout(shared_schema().schema(), *requested))
+        {
+            return export_native();
+        }
+
+        std::optional<sparrow::array> cast = cast_array(*source, shared_schema().schema(), source_owner, *requested);
+        if (!cast.has_value())
+        {
+            // Best effort: the consumer gets the native layout
+            return export_native();
+        }
+        return device ? export_array_to_device_capsules(*cast) : export_array_to_capsules(*cast);
+    }
+
+    void SparrowArray::materialize() const
+    {
+        if (m_array == nullptr)
+        {
+            // The sparrow array lives in the lazy holder, which exports may still reference
+            sparrow::array& materialized = m_lazy->materialize();
+            m_array = std::shared_ptr<sparrow::array>(std::move(m_lazy), &materialized);
+            m_lazy.reset();
+        }
+    }
+
+    const ArrowArray& SparrowArray::arrow_array() const
+    {
+        return m_array != nullptr ? *sparrow::get_arrow_array(*m_array) : m_lazy->arrow_array();
+    }
+
+    std::shared_ptr<const void> SparrowArray::owner() const
+    {
+        if (m_array != nullptr)
+        {
+            return m_array;
+        }
+        return m_lazy;
+    }
+
+    std::shared_ptr<const void> SparrowArray::writable_view_owner()
+    {
+        if (std::shared_ptr<const void> view = m_writable_view.lock())
+        {
+            return view;
+        }
+        materialize();
+        // A distinct handle holding the buffers, so that its lifetime is that of the views
+        std::shared_ptr<const void> view = std::make_shared<std::shared_ptr<const void>>(owner());
+        m_writable_view = view;
+        return view;
+    }
+
+    bool SparrowArray::has_writable_view() const
+    {
+        return !m_writable_view.expired();
+    }
+
+    const detail::shared_arrow_schema& SparrowArray::shared_schema() const
+    {
+        if (m_schema == nullptr)
+        {
+            const ArrowSchema& schema = m_array != nullptr ? *sparrow::get_arrow_schema(*m_array)
+                                                           : m_lazy->arrow_schema();
+            m_schema = detail::shared_arrow_schema::make(schema);
+        }
+        return *m_schema;
+    }
+
 }  // namespace sparrow::rockfinch
@@ -4,6 +4,8 @@
  */
 
 #include "sparrow_array_module.hpp"
+#include "sparrow_record_batch_module.hpp"
+#include "sparrow_stats_module.hpp"
 #include "sparrow_stream_module.hpp"
 
 #include <nanobind/nanobind.h>
@@ -15,10 +17,12 @@ namespace nb = nanobind;
 NB_MODULE(sparrow_rockfinch, m)
 {
     m.doc() = "Sparrow Rockfinch - High-performance Arrow array library for Python.\n\n"
-              "This module provides the SparrowArray and SparrowStream classes which\n"
-              "implement the Arrow PyCapsule Interface for zero-copy data exchange with\n"
-              "other Arrow-compatible libraries like Polars and PyArrow.";
+              "This module provides the SparrowArray, SparrowRecordBatch and SparrowStream\n"
+              "classes which implement the Arrow PyCapsule Interface for zero-copy data\n"
+              "exchange with other Arrow-compatible libraries like Polars and PyArrow.";
     m.attr("__version__") = sparrow::rockfinch::SPARROW_ROCKFINCH_VERSION_STRING.c_str();
     sparrow::rockfinch::register_sparrow_array(m);
+    sparrow::rockfinch::register_sparrow_record_batch(m);
     sparrow::rockfinch::register_sparrow_stream(m);
+    sparrow::rockfinch::register_sparrow_stats(m);
 }
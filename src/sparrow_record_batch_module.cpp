@@ -0,0 +1,304 @@
+/**
+ * @file sparrow_record_batch_module.cpp
+ * @brief Nanobind registration for SparrowRecordBatch.
+ */
+
+#include "sparrow_record_batch_module.hpp"
+#include "sparrow_array_module.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/string_view.h>
+#include <nanobind/stl/vector.h>
+
+#include <sparrow-rockfinch/detail/sparrow_array_numpy_interop.hpp>
+#include <sparrow-rockfinch/sparrow_record_batch_python_class.hpp>
+
+namespace nb = nanobind;
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        SparrowRecordBatch
+        sparrow_record_batch_from_arrow(const nb::object& arrow_array, bool lazy, std::string_view validate)
+        {
+            SparrowArray array = detail::sparrow_array_from_arrow(arrow_array, lazy, validate, false);
+            try
+            {
+                return SparrowRecordBatch(std::move(array));
+            }
+            catch (const std::invalid_argument& e)
+            {
+                throw nb::type_error(e.what());
+            }
+        }
+
+        SparrowRecordBatch sparrow_record_batch_from_ndarray(
+            const nb::object& array_obj,
+            const std::optional<std::vector<std::string>>& names,
+            bool align
+        )
+        {
+            const auto ndim = nb::cast<std::size_t>(array_obj.attr("ndim"));
+            if (ndim != 2)
+            {
+                throw nb::value_error("SparrowRecordBatch.from_ndarray() requires a 2D ndarray");
+            }
+            const auto n_columns = nb::cast<std::size_t>(nb::cast<nb::tuple>(array_obj.attr("shape"))[1]);
+
+            std::vector<std::string> column_names;
+            if (names.has_value())
+            {
+                column_names = *names;
+            }
+            else
+            {
+                column_names.reserve(n_columns);
+                for (std::size_t i = 0; i < n_columns; ++i)
+                {
+                    column_names.push_back(std::to_string(i));
+                }
+            }
+
+            // Columns of Fortran-ordered arrays are contiguous and shared, others are gathered
+            std::vector<SparrowArray> columns;
+            columns.reserve(n_columns);
+            for (std::size_t i = 0; i < n_columns; ++i)
+            {
+                nb::object column = array_obj[nb::make_tuple(nb::slice(nb::none(), nb::none(), nb::none()), i)];
+                columns.push_back(detail::sparrow_array_from_ndarray(column, align));
+            }
+            try
+            {
+                return SparrowRecordBatch(columns, column_names);
+            }
+            catch (const std::invalid_argument& e)
+            {
+                throw nb::value_error(e.what());
+            }
+        }
+
+        std::size_t resolve_column_index(const SparrowRecordBatch& self, const nb::handle& key)
+        {
+            if (nb::isinstance<nb::str>(key))
+            {
+                const auto name = nb::cast<std::string_view>(key);
+                const std::optional<std::size_t> index = self.column_index(name);
+                if (!index.has_value())
+                {
+                    throw nb::key_error(("No column named '" + std::string(name) + "'").c_str());
+                }
+                return *index;
+            }
+            if (nb::isinstance<nb::int_>(key))
+            {
+                const auto columns = static_cast<Py_ssize_t>(self.num_columns());
+                Py_ssize_t index = nb::cast<Py_ssize_t>(key);
+                if (index < 0)
+                {
+                    index += columns;
+                }
+                if (index < 0 || index >= columns)
+                {
+                    throw nb::index_error("SparrowRecordBatch column index out of range");
+                }
+                return static_cast<std::size_t>(index);
+            }
+            throw nb::type_error("Columns are selected by index (int) or name (str)");
+        }
+
+        SparrowArray sparrow_record_batch_column(const SparrowRecordBatch& self, const nb::handle& key)
+        {
+            return self.column(resolve_column_index(self, key));
+        }
+
+        nb::tuple sparrow_record_batch_to_arrow(const SparrowRecordBatch& self, nb::object requested_schema)
+        {
+            auto [schema, array] = self.export_to_capsules(requested_schema.ptr());
+            if (schema == nullptr || array == nullptr)
+            {
+                throw nb::python_error();
+            }
+            return nb::make_tuple(nb::steal(schema), nb::steal(array));
+        }
+
+        nb::tuple sparrow_record_batch_to_device_array(
+            const SparrowRecordBatch& self,
+            nb::object requested_schema,
+            const nb::kwargs& kwargs
+        )
+        {
+            validate_device_export_kwargs(kwargs);
+            auto [schema, device_array] = self.export_to_device_capsules(requested_schema.ptr());
+            if (schema == nullptr || device_array == nullptr)
+            {
+                throw nb::python_error();
+            }
+            return nb::make_tuple(nb::steal(schema), nb::steal(device_array));
+        }
+
+        nb::object sparrow_record_batch_to_schema(const SparrowRecordBatch& self)
+        {
+            PyObject* capsule = self.export_schema_to_capsule();
+            if (capsule == nullptr)
+            {
+                throw nb::python_error();
+            }
+            return nb::steal(capsule);
+        }
+    }
+
+    void register_sparrow_record_batch(nb::module_& m)
+    {
+        nb::class_<SparrowRecordBatch>(
+            m,
+            "SparrowRecordBatch",
+            "SparrowRecordBatch - Multi-column Arrow record batch implementing the\n"
+            "Arrow PyCapsule Interface.\n\n"
+            "The columns are the children of one struct array, so that the whole batch\n"
+            "is exported by a single __arrow_c_array__ call; no column buffer is copied,\n"
+            "neither on export nor on column access.\n\n"
+            "Example\n"
+            "-------\n"
+            ">>> import pyarrow as pa\n"
+            ">>> import sparrow_rockfinch as sp\n"
+            ">>> batch = sp.SparrowRecordBatch.from_arrow(pa.record_batch({'x': [1, 2]}))\n"
+            ">>> pa.record_batch(batch).column('x')"
+        )
+            .def(
+                nb::init<const std::vector<SparrowArray>&, const std::vector<std::string>&>(),
+                nb::arg("columns"),
+                nb::arg("names"),
+                "Create a record batch from columns of the same length.\n\n"
+                "The columns are shared, not copied.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "columns : Sequence[SparrowArray]\n"
+                "    The columns.\n"
+                "names : Sequence[str]\n"
+                "    The column names, one per column."
+            )
+            .def_static(
+                "from_arrow",
+                &sparrow_record_batch_from_arrow,
+                nb::arg("arrow_array"),
+                nb::arg("lazy") = false,
+                nb::arg("validate") = "trusted",
+                "Create a SparrowRecordBatch from an Arrow-compatible object.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "arrow_array : ArrowArrayExportable\n"
+                "    An object whose __arrow_c_array__ (or __arrow_c_device_array__)\n"
+                "    exports a struct array, e.g. a pyarrow.RecordBatch.\n"
+                "lazy : bool, default False\n"
+                "    As in SparrowArray.from_arrow.\n"
+                "validate : {'trusted', 'full'}, default 'trusted'\n"
+                "    As in SparrowArray.from_arrow.\n\n"
+                "Returns\n"
+                "-------\n"
+                "SparrowRecordBatch\n"
+                "    A new record batch wrapping the input data."
+            )
+            .def_static(
+                "from_ndarray",
+                &sparrow_record_batch_from_ndarray,
+                nb::arg("array"),
+                nb::arg("names") = nb::none(),
+                nb::arg("align") = false,
+                "Create a SparrowRecordBatch from the columns of a 2D NumPy ndarray.\n\n"
+                "Each column is imported as by SparrowArray.from_ndarray: the columns\n"
+                "of a Fortran-ordered (column-major) numeric ndarray are shared,\n"
+                "those of a C-ordered one are gathered into aligned buffers.\n"
+                "Use SparrowArray.from_ndarray to import the rows of a C-ordered\n"
+                "ndarray as fixed-size lists without copy instead.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "array : numpy.ndarray\n"
+                "    A 2D ndarray of a dtype supported by SparrowArray.from_ndarray.\n"
+                "names : Sequence[str], optional\n"
+                "    The column names; defaults to '0', '1', ...\n"
+                "align : bool, default False\n"
+                "    Copy the columns that are not 64-byte aligned.\n\n"
+                "Returns\n"
+                "-------\n"
+                "SparrowRecordBatch\n"
+                "    A new record batch with one column per ndarray column."
+            )
+            .def(
+                "__arrow_c_array__",
+                &sparrow_record_batch_to_arrow,
+                nb::arg("requested_schema") = nb::none(),
+                "Export the batch as one struct array via the Arrow PyCapsule interface.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "requested_schema : object, optional\n"
+                "    A PyCapsule containing a struct ArrowSchema; the columns are cast\n"
+                "    as in SparrowArray.__arrow_c_array__.\n\n"
+                "Returns\n"
+                "-------\n"
+                "tuple[object, object]\n"
+                "    A tuple of (schema_capsule, array_capsule)."
+            )
+            .def(
+                "__arrow_c_device_array__",
+                &sparrow_record_batch_to_device_array,
+                nb::arg("requested_schema") = nb::none(),
+                nb::arg("kwargs"),
+                "Export the batch via the Arrow PyCapsule interface for device data.\n\n"
+                "Same as SparrowArray.__arrow_c_device_array__ for the struct array.\n\n"
+                "Returns\n"
+                "-------\n"
+                "tuple[object, object]\n"
+                "    A tuple of (schema_capsule, device_array_capsule)."
+            )
+            .def(
+                "__arrow_c_schema__",
+                &sparrow_record_batch_to_schema,
+                "Export the struct schema via the Arrow PyCapsule interface.\n\n"
+                "Returns\n"
+                "-------\n"
+                "object\n"
+                "    A PyCapsule containing an ArrowSchema."
+            )
+            .def(
+                "column",
+                &sparrow_record_batch_column,
+                nb::arg("key"),
+                "Get a column by index or name, without copying its buffers.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "key : int or str\n"
+                "    The column index (negative values count from the end) or name.\n\n"
+                "Returns\n"
+                "-------\n"
+                "SparrowArray\n"
+                "    A lazy view of the column that keeps the batch data alive."
+            )
+            .def("__getitem__", &sparrow_record_batch_column, nb::arg("key"))
+            .def(
+                "columns",
+                &SparrowRecordBatch::columns,
+                "Get all the columns, without copying their buffers (see column())."
+            )
+            .def("column_names", &SparrowRecordBatch::column_names, "Get the column names.")
+            .def(
+                "to_struct_array",
+                [](const SparrowRecordBatch& self)
+                {
+                    return self.struct_array();
+                },
+                "Get the batch as a struct SparrowArray sharing its data."
+            )
+            .def("num_rows", &SparrowRecordBatch::num_rows, "Get the number of rows.")
+            .def("num_columns", &SparrowRecordBatch::num_columns, "Get the number of columns.")
+            .def("__len__", &SparrowRecordBatch::num_rows);
+    }
+}
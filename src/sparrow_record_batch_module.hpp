@@ -0,0 +1,8 @@
+#pragma once
+
+#include <nanobind/nanobind.h>
+
+namespace sparrow::rockfinch
+{
+    void register_sparrow_record_batch(nanobind::module_& m);
+}
@@ -0,0 +1,205 @@
+#include "sparrow-rockfinch/sparrow_record_batch_python_class.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <sparrow/array.hpp>
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/struct_array.hpp>
+
+#include "sparrow-rockfinch/detail/bitmap_kernels.hpp"
+#include "sparrow-rockfinch/detail/lazy_arrow_array.hpp"
+#include "sparrow-rockfinch/detail/shared_arrow_array.hpp"
+#include "sparrow-rockfinch/detail/shared_arrow_schema.hpp"
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        bool is_struct_format(const char* format)
+        {
+            return format != nullptr && std::strcmp(format, "+s") == 0;
+        }
+
+        // Null count of `child` restricted to `length` elements from its own offset.
+        // Unions and run-end encoded arrays never have nulls of their own.
+        std::int64_t sliced_null_count(const ArrowArray& child, const char* format, std::int64_t length)
+        {
+            if (std::strcmp(format, "n") == 0)
+            {
+                return length;
+            }
+            if (child.null_count == 0 || child.n_buffers == 0 || child.buffers[0] == nullptr
+                || std::strncmp(format, "+u", 2) == 0 || std::strcmp(format, "+r") == 0)
+            {
+                return 0;
+            }
+            const auto begin = static_cast<std::size_t>(child.offset);
+            const auto end = begin + static_cast<std::size_t>(length);
+            const auto* bitmap = static_cast<const std::uint8_t*>(child.buffers[0]);
+            return length - static_cast<std::int64_t>(detail::count_set_bits(bitmap, begin, end));
+        }
+    }
+
+    SparrowRecordBatch::SparrowRecordBatch(const std::vector<SparrowArray>& columns, const std::vector<std::string>& names)
+        : m_array(make_struct_array(columns, names))
+    {
+    }
+
+    SparrowRecordBatch::SparrowRecordBatch(SparrowArray struct_array)
+        : m_array(std::move(struct_array))
+    {
+        if (!is_struct_format(m_array.shared_schema().schema().format))
+        {
+            throw std::invalid_argument("SparrowRecordBatch requires a struct array");
+        }
+    }
+
+    std::pair<PyObject*, PyObject*> SparrowRecordBatch::export_to_capsules(PyObject* requested_schema) const
+    {
+        return m_array.export_to_capsules(requested_schema);
+    }
+
+    std::pair<PyObject*, PyObject*> SparrowRecordBatch::export_to_device_capsules(PyObject* requested_schema) const
+    {
+        return m_array.export_to_device_capsules(requested_schema);
+    }
+
+    PyObject* SparrowRecordBatch::export_schema_to_capsule() const
+    {
+        return m_array.export_schema_to_capsule();
+    }
+
+    std::size_t SparrowRecordBatch::num_rows() const
+    {
+        return m_array.size();
+    }
+
+    std::size_t SparrowRecordBatch::num_columns() const
+    {
+        return static_cast<std::size_t>(m_array.shared_schema().schema().n_children);
+    }
+
+    std::vector<std::string> SparrowRecordBatch::column_names() const
+    {
+        const ArrowSchema& schema = m_array.shared_schema().schema();
+        std::vector<std::string> names;
+        names.reserve(static_cast<std::size_t>(schema.n_children));
+        for (std::int64_t i = 0; i < schema.n_children; ++i)
+        {
+            const char* name = schema.children[i]->name;
+            names.emplace_back(name != nullptr ? name : "");
+        }
+        return names;
+    }
+
+    std::optional<std::size_t> SparrowRecordBatch::column_index(std::string_view name) const
+    {
+        const ArrowSchema& schema = m_array.shared_schema().schema();
+        for (std::int64_t i = 0; i < schema.n_children; ++i)
+        {
+            const char* child_name = schema.children[i]->name;
+            if (child_name != nullptr && name == child_name)
+            {
+                return static_cast<std::size_t>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    SparrowArray SparrowRecordBatch::column(std::size_t index) const
+    {
+        if (index >= num_columns())
+        {
+            throw std::out_of_range("SparrowRecordBatch column index out of range");
+        }
+
+        const ArrowArray& parent = m_array.arrow_array();
+        const ArrowSchema& parent_schema = m_array.shared_schema().schema();
+        const ArrowArray& source = *parent.children[index];
+        const ArrowSchema& source_schema = *parent_schema.children[index];
+
+        ArrowArray child_array{};
+        detail::make_shared_arrow_array(source, m_array.owner(), child_array);
+        if (parent.offset != 0 || source.length != parent.length)
+        {
+            // The struct is a slice: restrict the view to the rows it refers to
+            child_array.offset = source.offset + parent.offset;
+            child_array.length = parent.length;
+            child_array.null_count = sliced_null_count(child_array, source_schema.format, parent.length);
+        }
+
+        ArrowSchema child_schema{};
+        try
+        {
+            sparrow::copy_schema(source_schema, child_schema);
+        }
+        catch (...)
+        {
+            child_array.release(&child_array);
+            throw;
+        }
+        return SparrowArray(std::make_shared<detail::lazy_arrow_array>(std::move(child_array), std::move(child_schema)));
+    }
+
+    std::vector<SparrowArray> SparrowRecordBatch::columns() const
+    {
+        std::vector<SparrowArray> result;
+        result.reserve(num_columns());
+        for (std::size_t i = 0; i < num_columns(); ++i)
+        {
+            result.push_back(column(i));
+        }
+        return result;
+    }
+
+    const SparrowArray& SparrowRecordBatch::struct_array() const noexcept
+    {
+        return m_array;
+    }
+
+    SparrowArray
+    SparrowRecordBatch::make_struct_array(const std::vector<SparrowArray>& columns, const std::vector<std::string>& names)
+    {
+        if (columns.size() != names.size())
+        {
+            throw std::invalid_argument("SparrowRecordBatch needs exactly one name per column");
+        }
+
+        std::vector<sparrow::array> children;
+        children.reserve(columns.size());
+        for (std::size_t i = 0; i < columns.size(); ++i)
+        {
+            const SparrowArray& column = columns[i];
+            if (column.size() != columns.front().size())
+            {
+                throw std::invalid_argument("SparrowRecordBatch columns must all have the same length");
+            }
+
+            // Shared view of the column: only the small structures are allocated
+            const auto [column_array, column_owner] = column.export_source();
+            ArrowArray child_array{};
+            detail::make_shared_arrow_array(*column_array, column_owner, child_array);
+            ArrowSchema child_schema{};
+            try
+            {
+                sparrow::copy_schema(column.shared_schema().schema(), child_schema);
+            }
+            catch (...)
+            {
+                child_array.release(&child_array);
+                throw;
+            }
+            sparrow::array child(std::move(child_array), std::move(child_schema));
+            child.set_name(names[i]);
+            children.push_back(std::move(child));
+        }
+        // A record batch has no null rows of its own
+        return SparrowArray(sparrow::array(sparrow::struct_array(std::move(children), false)));
+    }
+
+}  // namespace sparrow::rockfinch
@@ -0,0 +1,86 @@
+/**
+ * @file sparrow_stats_module.cpp
+ * @brief Nanobind registration of the monitoring counters.
+ */
+
+#include "sparrow_stats_module.hpp"
+
+#include <sparrow-rockfinch/arrow_align.hpp>
+#include <sparrow-rockfinch/pycapsule.hpp>
+
+namespace nb = nanobind;
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        nb::dict pool_stats_to_dict(const capsule_pool_stats& stats)
+        {
+            nb::dict result;
+            result["hits"] = stats.hits;
+            result["misses"] = stats.misses;
+            result["cached"] = stats.cached;
+            return result;
+        }
+
+        nb::dict capsule_pool_stats_to_python()
+        {
+            const capsule_pools_stats stats = get_capsule_pools_stats();
+            nb::dict result;
+            result["schema"] = pool_stats_to_dict(stats.schema);
+            result["array"] = pool_stats_to_dict(stats.array);
+            result["stream"] = pool_stats_to_dict(stats.stream);
+            result["device_array"] = pool_stats_to_dict(stats.device_array);
+            result["device_stream"] = pool_stats_to_dict(stats.device_stream);
+            return result;
+        }
+
+        nb::dict realign_stats_to_python()
+        {
+            const realign_stats stats = get_realign_stats();
+            nb::dict result;
+            result["arrays_checked"] = stats.arrays_checked;
+            result["arrays_realigned"] = stats.arrays_realigned;
+            result["buffers_copied"] = stats.buffers_copied;
+            result["bytes_copied"] = stats.bytes_copied;
+            return result;
+        }
+    }
+
+    void register_sparrow_stats(nb::module_& m)
+    {
+        m.def(
+            "capsule_pool_stats",
+            &capsule_pool_stats_to_python,
+            "Return the counters of the pools backing the Arrow capsule structures.\n\n"
+            "Returns\n"
+            "-------\n"
+            "dict[str, dict[str, int]]\n"
+            "    For each of 'schema', 'array', 'stream', 'device_array' and\n"
+            "    'device_stream': the number of pool 'hits' (reused structures),\n"
+            "    'misses' (fresh allocations) and 'cached' structures currently\n"
+            "    held in the freelist."
+        );
+        m.def(
+            "reset_capsule_pool_stats",
+            &reset_capsule_pools_stats,
+            "Reset the hit/miss counters returned by capsule_pool_stats()."
+        );
+        m.def(
+            "realign_stats",
+            &realign_stats_to_python,
+            "Return the counters of the align=True imports.\n\n"
+            "Returns\n"
+            "-------\n"
+            "dict[str, int]\n"
+            "    'arrays_checked': arrays inspected, 'arrays_realigned': arrays\n"
+            "    for which something was copied, 'buffers_copied' and\n"
+            "    'bytes_copied': the buffers copied into 64-byte aligned storage."
+        );
+        m.def(
+            "reset_realign_stats",
+            &reset_realign_stats,
+            "Reset the counters returned by realign_stats()."
+        );
+    }
+}
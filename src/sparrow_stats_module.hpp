@@ -0,0 +1,8 @@
+#pragma once
+
+#include <nanobind/nanobind.h>
+
+namespace sparrow::rockfinch
+{
+    void register_sparrow_stats(nanobind::module_& m);
+}
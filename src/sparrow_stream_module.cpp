@@ -4,8 +4,12 @@
  */
 
 #include "sparrow_stream_module.hpp"
+#include "sparrow_array_module.hpp"
+
+#include <string_view>
 
 #include <nanobind/stl/optional.h>
+#include <nanobind/stl/string_view.h>
 
 #include <sparrow-rockfinch/pycapsule.hpp>
 #include <sparrow-rockfinch/sparrow_stream_python_class.hpp>
@@ -18,29 +22,42 @@ namespace sparrow::rockfinch
 {
     namespace
     {
-        SparrowStream sparrow_stream_from_stream(const nb::object& stream_obj)
+        SparrowStream sparrow_stream_from_stream(const nb::object& stream_obj, std::string_view validate)
         {
+            const validation_mode mode = parse_validation_mode(validate);
             PyObject* stream_capsule = nullptr;
             nb::object capsule_holder;
+            bool device = false;
 
             if (PyCapsule_CheckExact(stream_obj.ptr()))
             {
                 stream_capsule = stream_obj.ptr();
+                const char* name = PyCapsule_GetName(stream_capsule);
+                device = name != nullptr && std::string_view(name) == "arrow_device_array_stream";
             }
             else if (nb::hasattr(stream_obj, "__arrow_c_stream__"))
             {
                 capsule_holder = stream_obj.attr("__arrow_c_stream__")();
                 stream_capsule = capsule_holder.ptr();
             }
+            else if (nb::hasattr(stream_obj, "__arrow_c_device_stream__"))
+            {
+                capsule_holder = stream_obj.attr("__arrow_c_device_stream__")();
+                stream_capsule = capsule_holder.ptr();
+                device = true;
+            }
             else
             {
                 throw nb::type_error(
-                    "Input object must implement __arrow_c_stream__ (ArrowStreamExportable protocol) "
-                    "or be an arrow_array_stream PyCapsule"
+                    "Input object must implement __arrow_c_stream__ (ArrowStreamExportable protocol), "
+                    "__arrow_c_device_stream__ (ArrowDeviceStreamExportable protocol) "
+                    "or be an arrow_array_stream / arrow_device_array_stream PyCapsule"
                 );
             }
 
-            sparrow::arrow_array_stream_proxy proxy = import_stream_proxy_from_capsule(stream_capsule);
+            sparrow::arrow_array_stream_proxy proxy = device
+                                                          ? import_stream_proxy_from_device_capsule(stream_capsule, mode)
+                                                          : import_stream_proxy_from_capsule(stream_capsule, mode);
             if (PyErr_Occurred())
             {
                 throw nb::python_error();
@@ -49,9 +66,21 @@ namespace sparrow::rockfinch
             return SparrowStream(std::move(proxy));
         }
 
-        nb::object sparrow_stream_to_stream(SparrowStream& self, nb::object /*requested_schema*/)
+        nb::object sparrow_stream_to_stream(SparrowStream& self, nb::object requested_schema)
         {
-            PyObject* capsule = self.export_to_capsule();
+            PyObject* capsule = self.export_to_capsule(requested_schema.ptr());
+            if (capsule == nullptr)
+            {
+                throw nb::python_error();
+            }
+            return nb::steal(capsule);
+        }
+
+        nb::object
+        sparrow_stream_to_device_stream(SparrowStream& self, nb::object requested_schema, const nb::kwargs& kwargs)
+        {
+            validate_device_export_kwargs(kwargs);
+            PyObject* capsule = self.export_to_device_capsule(requested_schema.ptr());
             if (capsule == nullptr)
             {
                 throw nb::python_error();
@@ -81,11 +110,17 @@ namespace sparrow::rockfinch
                 "from_stream",
                 &sparrow_stream_from_stream,
                 nb::arg("stream"),
+                nb::arg("validate") = "trusted",
                 "Create a SparrowStream from a stream-compatible object.\n\n"
                 "Parameters\n"
                 "----------\n"
                 "stream : ArrowStreamExportable\n"
-                "    An object implementing __arrow_c_stream__ or a PyCapsule.\n\n"
+                "    An object implementing __arrow_c_stream__ or\n"
+                "    __arrow_c_device_stream__ (CPU data), or a PyCapsule.\n"
+                "validate : {'trusted', 'full'}, default 'trusted'\n"
+                "    With 'full', every batch is checked as in\n"
+                "    SparrowArray.from_arrow(validate='full') when it is read;\n"
+                "    an invalid batch makes the read fail.\n\n"
                 "Returns\n"
                 "-------\n"
                 "SparrowStream\n"
@@ -102,12 +137,37 @@ namespace sparrow::rockfinch
                 "----------\n"
                 "requested_schema : object, optional\n"
                 "    A PyCapsule containing an ArrowSchema for requested format.\n"
-                "    Currently ignored (best-effort conversion not implemented).\n\n"
+                "    When it differs from the stream layout, the batches are cast\n"
+                "    (numeric widening/narrowing, utf8 <-> large_utf8, binary <->\n"
+                "    large_binary, struct fields). If the stream schema cannot be\n"
+                "    cast to it, the native layout is exported. Batches are cast as\n"
+                "    they are read: one whose values do not fit the requested type\n"
+                "    makes get_next fail with EINVAL.\n\n"
                 "Returns\n"
                 "-------\n"
                 "object\n"
                 "    A PyCapsule containing an ArrowArrayStream."
             )
+            .def(
+                "__arrow_c_device_stream__",
+                &sparrow_stream_to_device_stream,
+                nb::arg("requested_schema") = nb::none(),
+                nb::arg("kwargs"),
+                "Export the stream via the Arrow PyCapsule interface for device data.\n\n"
+                "The batches always live in CPU memory (ARROW_DEVICE_CPU). Like\n"
+                "__arrow_c_stream__, the stream can only be consumed once.\n\n"
+                "Parameters\n"
+                "----------\n"
+                "requested_schema : object, optional\n"
+                "    A PyCapsule containing an ArrowSchema for requested format,\n"
+                "    handled as in __arrow_c_stream__.\n"
+                "**kwargs\n"
+                "    Reserved by the protocol; non-None values raise NotImplementedError.\n\n"
+                "Returns\n"
+                "-------\n"
+                "object\n"
+                "    A PyCapsule containing an ArrowDeviceArrayStream."
+            )
             .def("push", &SparrowStream::push, nb::arg("arr"), "Push a SparrowArray into the stream.")
             .def(
                 "pop",
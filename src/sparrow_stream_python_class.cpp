@@ -3,11 +3,161 @@
  * @brief Implementation of the SparrowStream class.
  */
 
+#include <sparrow-rockfinch/arrow_cast.hpp>
 #include <sparrow-rockfinch/pycapsule.hpp>
 #include <sparrow-rockfinch/sparrow_stream_python_class.hpp>
 
+#include <cerrno>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <sparrow/c_interface.hpp>
+#include <sparrow/arrow_interface/arrow_schema.hpp>
+
 namespace sparrow::rockfinch
 {
+    namespace
+    {
+        PyObject* export_proxy_to_capsule(sparrow::arrow_array_stream_proxy& proxy, bool device)
+        {
+            return device ? export_stream_proxy_to_device_capsule(proxy) : export_stream_proxy_to_capsule(proxy);
+        }
+
+        // ArrowArrayStream casting every batch of another stream to a requested schema,
+        // one batch at a time
+        struct cast_stream_private_data
+        {
+            ArrowArrayStream stream;
+            // Released (release == nullptr) for an empty stream without a schema
+            ArrowSchema schema{};
+            ArrowSchema requested{};
+            std::string last_error;
+        };
+
+        int cast_stream_get_schema(ArrowArrayStream* self, ArrowSchema* out)
+        {
+            auto* private_data = static_cast<cast_stream_private_data*>(self->private_data);
+            try
+            {
+                sparrow::copy_schema(private_data->requested, *out);
+            }
+            catch (...)
+            {
+                private_data->last_error = "Failed to copy the requested schema";
+                return ENOMEM;
+            }
+            return 0;
+        }
+
+        int cast_stream_get_next(ArrowArrayStream* self, ArrowArray* out)
+        {
+            auto* private_data = static_cast<cast_stream_private_data*>(self->private_data);
+            ArrowArrayStream& source = private_data->stream;
+            private_data->last_error.clear();
+            *out = ArrowArray{};
+            if (private_data->schema.release == nullptr)
+            {
+                return 0;
+            }
+
+            ArrowArray batch{};
+            const int code = source.get_next(&source, &batch);
+            if (code != 0 || batch.release == nullptr)
+            {
+                *out = batch;
+                return code;
+            }
+            try
+            {
+                // The cast batch shares the buffers it does not convert with `batch`
+                std::shared_ptr<ArrowArray> owner(
+                    new ArrowArray(std::exchange(batch, ArrowArray{})),
+                    [](ArrowArray* array)
+                    {
+                        if (array->release != nullptr)
+                        {
+                            array->release(array);
+                        }
+                        delete array;
+                    }
+                );
+                if (!cast_arrow_array(*owner, private_data->schema, owner, private_data->requested, *out))
+                {
+                    private_data->last_error = "A batch of the stream cannot be cast to the requested schema "
+                                               "without losing values";
+                    return EINVAL;
+                }
+            }
+            catch (...)
+            {
+                if (batch.release != nullptr)
+                {
+                    batch.release(&batch);
+                }
+                private_data->last_error = "Failed to cast a batch of the stream to the requested schema";
+                return ENOMEM;
+            }
+            return 0;
+        }
+
+        const char* cast_stream_get_last_error(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<cast_stream_private_data*>(self->private_data);
+            if (!private_data->last_error.empty())
+            {
+                return private_data->last_error.c_str();
+            }
+            return private_data->stream.get_last_error(&private_data->stream);
+        }
+
+        void cast_stream_release(ArrowArrayStream* self)
+        {
+            auto* private_data = static_cast<cast_stream_private_data*>(self->private_data);
+            for (ArrowSchema* schema : {&private_data->schema, &private_data->requested})
+            {
+                if (schema->release != nullptr)
+                {
+                    schema->release(schema);
+                }
+            }
+            if (private_data->stream.release != nullptr)
+            {
+                private_data->stream.release(&private_data->stream);
+            }
+            delete private_data;
+            self->private_data = nullptr;
+            self->release = nullptr;
+        }
+
+        // Reads the schema of `stream`; leaves `schema` released if the stream is
+        // empty and has none. Returns false with a Python error set on failure.
+        bool read_stream_schema(ArrowArrayStream& stream, ArrowSchema& schema)
+        {
+            if (stream.get_schema(&stream, &schema) == 0)
+            {
+                return true;
+            }
+            schema = ArrowSchema{};
+            const char* error = stream.get_last_error(&stream);
+            const std::string message = error != nullptr ? error : "unknown error";
+
+            // A stream without any batch may not know its schema
+            ArrowArray batch{};
+            const int code = stream.get_next(&stream, &batch);
+            if (code == 0 && batch.release == nullptr)
+            {
+                return true;
+            }
+            if (batch.release != nullptr)
+            {
+                batch.release(&batch);
+            }
+            PyErr_Format(PyExc_RuntimeError, "Failed to read the schema of the stream: %s", message.c_str());
+            return false;
+        }
+    }
+
     SparrowStream::SparrowStream(sparrow::arrow_array_stream_proxy&& proxy)
         : m_stream_proxy(std::move(proxy))
     {
@@ -34,6 +184,85 @@ namespace sparrow::rockfinch
         return capsule;
     }
 
+    PyObject* SparrowStream::export_to_capsule(PyObject* requested_schema)
+    {
+        return export_requested(requested_schema, false);
+    }
+
+    PyObject* SparrowStream::export_to_device_capsule(PyObject* requested_schema)
+    {
+        return export_requested(requested_schema, true);
+    }
+
+    PyObject* SparrowStream::export_requested(PyObject* requested_schema, bool device)
+    {
+        if (m_consumed)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "SparrowStream has already been consumed");
+            return nullptr;
+        }
+        if (requested_schema == nullptr || requested_schema == Py_None)
+        {
+            m_consumed = true;
+            return export_proxy_to_capsule(m_stream_proxy, device);
+        }
+        const ArrowSchema* requested = get_schema_from_capsule(requested_schema);
+        if (requested == nullptr)
+        {
+            return nullptr;
+        }
+        m_consumed = true;
+        return export_cast_to_capsule(*requested, device);
+    }
+
+    PyObject* SparrowStream::export_cast_to_capsule(const ArrowSchema& requested, bool device)
+    {
+        ArrowArrayStream* exported = m_stream_proxy.export_stream();
+        if (exported == nullptr)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to export stream from proxy");
+            return nullptr;
+        }
+        auto* private_data = new cast_stream_private_data{*exported, ArrowSchema{}, ArrowSchema{}, std::string()};
+        exported->release = nullptr;
+
+        ArrowArrayStream stream{};
+        stream.get_schema = &cast_stream_get_schema;
+        stream.get_next = &cast_stream_get_next;
+        stream.get_last_error = &cast_stream_get_last_error;
+        stream.release = &cast_stream_release;
+        stream.private_data = private_data;
+
+        // Castability is decided from the schemas, before any batch is read
+        if (!read_stream_schema(private_data->stream, private_data->schema))
+        {
+            stream.release(&stream);
+            return nullptr;
+        }
+        const ArrowSchema& schema = private_data->schema;
+        if (schema.release != nullptr && (has_same_layout(schema, requested) || !can_cast(schema, requested)))
+        {
+            // Nothing to cast, or best effort: the consumer gets the native layout
+            ArrowArrayStream native = private_data->stream;
+            private_data->stream.release = nullptr;
+            stream.release(&stream);
+            sparrow::arrow_array_stream_proxy native_proxy(std::move(native));
+            return export_proxy_to_capsule(native_proxy, device);
+        }
+
+        try
+        {
+            sparrow::copy_schema(requested, private_data->requested);
+        }
+        catch (...)
+        {
+            stream.release(&stream);
+            throw;
+        }
+        sparrow::arrow_array_stream_proxy cast_proxy(std::move(stream));
+        return export_proxy_to_capsule(cast_proxy, device);
+    }
+
     std::optional<SparrowArray> SparrowStream::pop()
     {
         if (m_consumed)
@@ -0,0 +1,405 @@
+/**
+ * @file strided_gather.cpp
+ * @brief Implementation of the strided gather kernels.
+ */
+
+#include <sparrow-rockfinch/detail/strided_gather.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// AVX2 is compiled with a function-level target attribute and selected at run
+// time, as for the bitmap kernels.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    define SPARROW_ROCKFINCH_GATHER_AVX2 1
+#    include <immintrin.h>
+#else
+#    define SPARROW_ROCKFINCH_GATHER_AVX2 0
+#endif
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        // Bytes gathered by each additional thread, at least
+        constexpr std::size_t gather_bytes_per_thread = std::size_t{1} << 20;
+
+        // Threads gathering one buffer, the calling one included, at most: the
+        // copies are bound by memory bandwidth well before this
+        constexpr std::size_t max_gather_threads = 8;
+
+        template <std::size_t N>
+        void gather_items(const std::byte* source, std::ptrdiff_t stride, std::size_t length, std::byte* target) noexcept
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                std::memcpy(target + i * N, source + static_cast<std::ptrdiff_t>(i) * stride, N);
+            }
+        }
+
+        void gather_range(
+            const std::byte* source,
+            std::ptrdiff_t stride,
+            std::size_t item_size,
+            std::size_t length,
+            std::byte* target
+        ) noexcept
+        {
+            switch (item_size)
+            {
+                case 1:
+                    gather_items<1>(source, stride, length, target);
+                    break;
+                case 2:
+                    gather_items<2>(source, stride, length, target);
+                    break;
+                case 4:
+                    gather_items<4>(source, stride, length, target);
+                    break;
+                case 8:
+                    gather_items<8>(source, stride, length, target);
+                    break;
+                default:
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        std::memcpy(target + i * item_size, source + static_cast<std::ptrdiff_t>(i) * stride, item_size);
+                    }
+                    break;
+            }
+        }
+
+        template <typename U>
+        U byteswap(U value) noexcept
+        {
+#if defined(__GNUC__)
+            if constexpr (sizeof(U) == 2)
+            {
+                return __builtin_bswap16(value);
+            }
+            else if constexpr (sizeof(U) == 4)
+            {
+                return __builtin_bswap32(value);
+            }
+            else
+            {
+                return __builtin_bswap64(value);
+            }
+#else
+            U result = 0;
+            for (std::size_t i = 0; i < sizeof(U); ++i)
+            {
+                result = static_cast<U>((result << 8) | ((value >> (8 * i)) & 0xFFu));
+            }
+            return result;
+#endif
+        }
+
+#if SPARROW_ROCKFINCH_GATHER_AVX2
+        // Byte order of _mm256_shuffle_epi8 reversing each N-byte item (within 128-bit lanes)
+        template <std::size_t N>
+        constexpr std::array<std::uint8_t, 32> byteswap_shuffle = []
+        {
+            std::array<std::uint8_t, 32> order{};
+            for (std::size_t j = 0; j < order.size(); ++j)
+            {
+                const std::size_t k = j % 16;
+                order[j] = static_cast<std::uint8_t>((k / N) * N + (N - 1 - k % N));
+            }
+            return order;
+        }();
+
+        // Swap whole 32-byte vectors of contiguous N-byte items; returns the number of items done
+        template <std::size_t N>
+        __attribute__((target("avx2"))) std::size_t
+        byteswap_contiguous_avx2(const std::byte* source, std::size_t length, std::byte* target) noexcept
+        {
+            const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(byteswap_shuffle<N>.data()));
+            constexpr std::size_t per_vector = 32 / N;
+            std::size_t i = 0;
+            for (; length - i >= per_vector; i += per_vector)
+            {
+                const __m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * N));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i * N), _mm256_shuffle_epi8(items, shuffle));
+            }
+            return i;
+        }
+
+        // Resolved once, when the library is loaded
+        const bool byteswap_has_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+        template <typename U>
+        void byteswap_items(const std::byte* source, std::ptrdiff_t stride, std::size_t length, std::byte* target) noexcept
+        {
+            std::size_t i = 0;
+#if SPARROW_ROCKFINCH_GATHER_AVX2
+            if (byteswap_has_avx2 && stride == static_cast<std::ptrdiff_t>(sizeof(U)))
+            {
+                i = byteswap_contiguous_avx2<sizeof(U)>(source, length, target);
+            }
+#endif
+            for (; i < length; ++i)
+            {
+                U item;
+                std::memcpy(&item, source + static_cast<std::ptrdiff_t>(i) * stride, sizeof(U));
+                item = byteswap(item);
+                std::memcpy(target + i * sizeof(U), &item, sizeof(U));
+            }
+        }
+
+        void byteswap_range(
+            const std::byte* source,
+            std::ptrdiff_t stride,
+            std::size_t item_size,
+            std::size_t length,
+            std::byte* target
+        ) noexcept
+        {
+            switch (item_size)
+            {
+                case 2:
+                    byteswap_items<std::uint16_t>(source, stride, length, target);
+                    break;
+                case 4:
+                    byteswap_items<std::uint32_t>(source, stride, length, target);
+                    break;
+                case 8:
+                    byteswap_items<std::uint64_t>(source, stride, length, target);
+                    break;
+                default:
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        std::reverse_copy(
+                            source + static_cast<std::ptrdiff_t>(i) * stride,
+                            source + static_cast<std::ptrdiff_t>(i) * stride + static_cast<std::ptrdiff_t>(item_size),
+                            target + i * item_size
+                        );
+                    }
+                    break;
+            }
+        }
+
+        using range_fn = void (*)(const std::byte*, std::ptrdiff_t, std::size_t, std::size_t, std::byte*) noexcept;
+
+        // One gather split in contiguous ranges, claimed in turn by the calling
+        // thread and the pool workers helping it
+        struct gather_job
+        {
+            range_fn kernel;
+            const std::byte* source;
+            std::ptrdiff_t stride;
+            std::size_t item_size;
+            std::size_t length;
+            std::byte* target;
+            std::size_t chunk;
+            std::size_t n_ranges;
+            std::atomic<std::size_t> next_range{0};
+            // Workers running ranges of the job, guarded by the pool mutex
+            std::size_t helpers = 0;
+
+            void run_ranges() noexcept
+            {
+                for (std::size_t range = next_range.fetch_add(1, std::memory_order_relaxed); range < n_ranges;
+                     range = next_range.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const std::size_t begin = range * chunk;
+                    kernel(
+                        source + static_cast<std::ptrdiff_t>(begin) * stride,
+                        stride,
+                        item_size,
+                        std::min(chunk, length - begin),
+                        target + begin * item_size
+                    );
+                }
+            }
+        };
+
+        // Worker threads shared by all gathers, started on the first large one.
+        // The calling thread claims ranges too and never waits for a range no
+        // worker has started, so gathers complete even when every worker is busy
+        // with another one, or when no worker could be started.
+        class gather_pool
+        {
+        public:
+
+            gather_pool() noexcept
+            {
+                const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+                const std::size_t n_workers = std::min(hardware, max_gather_threads) - 1;
+                try
+                {
+                    m_workers.reserve(n_workers);
+                    while (m_workers.size() < n_workers)
+                    {
+                        m_workers.emplace_back(&gather_pool::work, this);
+                    }
+                }
+                catch (...)
+                {
+                    // Run with the workers started so far
+                }
+            }
+
+            ~gather_pool()
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_work_available.notify_all();
+                for (auto& worker : m_workers)
+                {
+                    worker.join();
+                }
+            }
+
+            gather_pool(const gather_pool&) = delete;
+            gather_pool& operator=(const gather_pool&) = delete;
+
+            std::size_t size() const noexcept
+            {
+                return m_workers.size();
+            }
+
+            // Run every range of `job`, with the help of up to `n_helpers` workers
+            void run(gather_job& job, std::size_t n_helpers) noexcept
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    try
+                    {
+                        for (std::size_t i = 0; i < n_helpers; ++i)
+                        {
+                            m_pending.push_back(&job);
+                        }
+                    }
+                    catch (...)
+                    {
+                        // Fewer helpers: the calling thread claims the other ranges
+                    }
+                }
+                m_work_available.notify_all();
+
+                job.run_ranges();
+
+                // Every range is claimed: withdraw the requests no worker has
+                // taken, then wait for the ranges still being gathered
+                std::unique_lock lock(m_mutex);
+                m_pending.erase(std::remove(m_pending.begin(), m_pending.end(), &job), m_pending.end());
+                m_job_done.wait(
+                    lock,
+                    [&job]
+                    {
+                        return job.helpers == 0;
+                    }
+                );
+            }
+
+        private:
+
+            void work() noexcept
+            {
+                std::unique_lock lock(m_mutex);
+                while (true)
+                {
+                    m_work_available.wait(
+                        lock,
+                        [this]
+                        {
+                            return m_stopping || !m_pending.empty();
+                        }
+                    );
+                    if (m_pending.empty())
+                    {
+                        return;
+                    }
+                    gather_job* job = m_pending.front();
+                    m_pending.pop_front();
+                    ++job->helpers;
+                    lock.unlock();
+                    job->run_ranges();
+                    lock.lock();
+                    if (--job->helpers == 0)
+                    {
+                        m_job_done.notify_all();
+                    }
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_work_available;
+            std::condition_variable m_job_done;
+            std::deque<gather_job*> m_pending;
+            bool m_stopping = false;
+            std::vector<std::thread> m_workers;
+        };
+
+        // The pool is intentionally leaked: joining its workers from static
+        // destructors may hang at shutdown (e.g. on Windows DLL detach).
+        gather_pool& shared_gather_pool() noexcept
+        {
+            static gather_pool& pool = *new gather_pool;
+            return pool;
+        }
+
+        // Run `kernel` over the elements, split in contiguous ranges across the
+        // pool workers when large
+        void run_in_ranges(
+            range_fn kernel,
+            const std::byte* source,
+            std::ptrdiff_t stride,
+            std::size_t item_size,
+            std::size_t length,
+            std::byte* target
+        ) noexcept
+        {
+            const std::size_t bytes = length * item_size;
+            if (bytes < parallel_gather_min_bytes)
+            {
+                kernel(source, stride, item_size, length, target);
+                return;
+            }
+            gather_pool& pool = shared_gather_pool();
+            const std::size_t n_threads = std::min(pool.size() + 1, bytes / gather_bytes_per_thread);
+            if (n_threads <= 1)
+            {
+                kernel(source, stride, item_size, length, target);
+                return;
+            }
+
+            const std::size_t chunk = (length + n_threads - 1) / n_threads;
+            gather_job job{kernel, source, stride, item_size, length, target, chunk, (length + chunk - 1) / chunk};
+            pool.run(job, job.n_ranges - 1);
+        }
+    }
+
+    void gather_strided(
+        const std::byte* source,
+        std::ptrdiff_t stride,
+        std::size_t item_size,
+        std::size_t length,
+        std::byte* target
+    ) noexcept
+    {
+        run_in_ranges(&gather_range, source, stride, item_size, length, target);
+    }
+
+    void gather_strided_byteswap(
+        const std::byte* source,
+        std::ptrdiff_t stride,
+        std::size_t item_size,
+        std::size_t length,
+        std::byte* target
+    ) noexcept
+    {
+        run_in_ranges(&byteswap_range, source, stride, item_size, length, target);
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file struct_pool.cpp
+ * @brief Process-wide pools for the Arrow C interface structures.
+ */
+
+#include <sparrow-rockfinch/detail/struct_pool.hpp>
+
+#include <sparrow-rockfinch/arrow_device_interface.hpp>
+
+#include <sparrow/c_interface.hpp>
+
+namespace sparrow::rockfinch
+{
+    namespace detail
+    {
+        // The pools are intentionally leaked: capsules may be destroyed during
+        // interpreter shutdown, after static destructors would have run.
+
+        struct_pool<ArrowSchema>& arrow_schema_pool()
+        {
+            static auto* pool = new struct_pool<ArrowSchema>();
+            return *pool;
+        }
+
+        struct_pool<ArrowArray>& arrow_array_pool()
+        {
+            static auto* pool = new struct_pool<ArrowArray>();
+            return *pool;
+        }
+
+        struct_pool<ArrowArrayStream>& arrow_array_stream_pool()
+        {
+            static auto* pool = new struct_pool<ArrowArrayStream>();
+            return *pool;
+        }
+
+        struct_pool<ArrowDeviceArray>& arrow_device_array_pool()
+        {
+            static auto* pool = new struct_pool<ArrowDeviceArray>();
+            return *pool;
+        }
+
+        struct_pool<ArrowDeviceArrayStream>& arrow_device_array_stream_pool()
+        {
+            static auto* pool = new struct_pool<ArrowDeviceArrayStream>();
+            return *pool;
+        }
+    }
+
+    capsule_pools_stats get_capsule_pools_stats()
+    {
+        return {
+            detail::arrow_schema_pool().stats(),
+            detail::arrow_array_pool().stats(),
+            detail::arrow_array_stream_pool().stats(),
+            detail::arrow_device_array_pool().stats(),
+            detail::arrow_device_array_stream_pool().stats()
+        };
+    }
+
+    void reset_capsule_pools_stats()
+    {
+        detail::arrow_schema_pool().reset_stats();
+        detail::arrow_array_pool().reset_stats();
+        detail::arrow_array_stream_pool().reset_stats();
+        detail::arrow_device_array_pool().reset_stats();
+        detail::arrow_device_array_stream_pool().reset_stats();
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file arrow_test_fixtures.hpp
+ * @brief Hand-made ``ArrowSchema`` / ``ArrowArray`` structures for the C++ tests.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <sparrow/c_interface.hpp>
+
+namespace sparrow::rockfinch::test
+{
+    // Hand-made structures borrow their buffers; releasing them is a no-op
+    inline void release_nothing(ArrowArray*)
+    {
+    }
+
+    inline void release_nothing(ArrowSchema*)
+    {
+    }
+
+    inline ArrowSchema make_schema(const char* format)
+    {
+        ArrowSchema schema{};
+        schema.format = format;
+        schema.release = &release_nothing;
+        return schema;
+    }
+
+    inline ArrowArray make_array(
+        std::int64_t length,
+        std::vector<const void*>& buffers,
+        std::int64_t offset = 0,
+        std::int64_t null_count = 0
+    )
+    {
+        ArrowArray array{};
+        array.length = length;
+        array.offset = offset;
+        array.null_count = null_count;
+        array.n_buffers = static_cast<std::int64_t>(buffers.size());
+        array.buffers = buffers.data();
+        array.release = &release_nothing;
+        return array;
+    }
+}
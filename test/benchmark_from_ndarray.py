@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""
+Microbenchmark of SparrowArray.from_ndarray() on small arrays.
+
+For small arrays the cost of from_ndarray() is dominated by its fixed overhead
+(buffer acquisition, dtype dispatch and Arrow structure setup), not by the
+data, so this tracks the per-call overhead for each supported dtype.
+
+Run with the same environment as test_ndarray.py (see the pixi task
+``bench_from_ndarray``).
+"""
+
+from __future__ import annotations
+
+import argparse
+import timeit
+
+import numpy as np
+
+from sparrow_helpers import SparrowArray
+
+DTYPES = [
+    np.bool_,
+    np.int8,
+    np.uint8,
+    np.int16,
+    np.uint16,
+    np.int32,
+    np.uint32,
+    np.int64,
+    np.uint64,
+    np.float16,
+    np.float32,
+    np.float64,
+]
+
+
+def bench(dtype, size: int, number: int, repeat: int) -> float:
+    """Return the best time per call in nanoseconds."""
+    source = np.ones(size, dtype=dtype)
+    timer = timeit.Timer(lambda: SparrowArray.from_ndarray(source))
+    return min(timer.repeat(repeat=repeat, number=number)) / number * 1e9
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--size", type=int, default=100, help="number of elements (default: 100)")
+    parser.add_argument("--number", type=int, default=100_000, help="calls per measurement")
+    parser.add_argument("--repeat", type=int, default=5, help="measurements per dtype (best is kept)")
+    args = parser.parse_args()
+
+    print(f"from_ndarray, {args.size} elements")
+    for dtype in DTYPES:
+        ns = bench(dtype, args.size, args.number, args.repeat)
+        print(f"  {np.dtype(dtype).name:>8}: {ns:8.1f} ns/call")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""
+Microbenchmark of SparrowArray.to_numpy() on small arrays.
+
+For small arrays the cost of a zero-copy to_numpy() is its fixed overhead
+(dtype dispatch and construction of the ndarray view), so this tracks the
+per-call overhead for each dtype exported as a view. The arrays are imported
+from pyarrow, so the numpy_owner shortcut of ndarray-originated arrays is not
+taken; ``--copy`` measures the copying export instead.
+
+Run with the same environment as test_ndarray.py (see the pixi task
+``bench_to_numpy``).
+"""
+
+from __future__ import annotations
+
+import argparse
+import timeit
+
+import numpy as np
+import pyarrow as pa
+
+from sparrow_helpers import SparrowArray
+
+DTYPES = [
+    pa.int8(),
+    pa.uint8(),
+    pa.int16(),
+    pa.uint16(),
+    pa.int32(),
+    pa.uint32(),
+    pa.int64(),
+    pa.uint64(),
+    pa.float16(),
+    pa.float32(),
+    pa.float64(),
+    pa.timestamp("us"),
+    pa.duration("ns"),
+]
+
+
+def bench(dtype: pa.DataType, size: int, copy: bool, number: int, repeat: int) -> float:
+    """Return the best time per call in nanoseconds."""
+    values = np.ones(size, dtype=dtype.to_pandas_dtype())
+    sparrow_array = SparrowArray.from_arrow(pa.array(values, type=dtype))
+    timer = timeit.Timer(lambda: sparrow_array.to_numpy(copy=copy))
+    return min(timer.repeat(repeat=repeat, number=number)) / number * 1e9
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--size", type=int, default=100, help="number of elements (default: 100)")
+    parser.add_argument("--copy", action="store_true", help="benchmark to_numpy(copy=True)")
+    parser.add_argument("--number", type=int, default=100_000, help="calls per measurement")
+    parser.add_argument("--repeat", type=int, default=5, help="measurements per dtype (best is kept)")
+    args = parser.parse_args()
+
+    print(f"to_numpy(copy={args.copy}), {args.size} elements")
+    for dtype in DTYPES:
+        ns = bench(dtype, args.size, args.copy, args.number, args.repeat)
+        print(f"  {str(dtype):>14}: {ns:8.1f} ns/call")
+
+
+if __name__ == "__main__":
+    main()
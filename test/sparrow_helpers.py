@@ -37,13 +37,32 @@ class SparrowArrayType(ArrowArrayExportable, Protocol):
         """Get the number of elements in the array."""
         ...
 
-    def to_numpy(self, copy: bool = False):
-        """Export the array as a NumPy ndarray."""
+    def to_numpy(
+        self,
+        copy: bool = False,
+        nulls: Any = None,
+        fill_value: Any = None,
+        writable: bool = False,
+        dictionary: Any = None,
+    ):
+        """Export the array as a NumPy ndarray, or as (codes, categories) with dictionary='codes'."""
+        ...
+
+    def to_categorical(self):
+        """Export a dictionary-encoded array as a pandas.Categorical."""
         ...
 
     def __array__(self, dtype: Any = None, copy: Any = None):
         """NumPy array protocol hook."""
         ...
+
+    def __dlpack__(self, *, stream: Any = None, max_version: Any = None, dl_device: Any = None, copy: Any = None):
+        """Export the array as a DLPack capsule."""
+        ...
+
+    def __dlpack_device__(self) -> tuple[int, int]:
+        """Return the DLPack device of the array."""
+        ...
     
     @classmethod
     def from_arrow(cls, arrow_array: ArrowArrayExportable) -> "SparrowArrayType":
@@ -55,6 +74,11 @@ class SparrowArrayType(ArrowArrayExportable, Protocol):
         """Create a SparrowArray from a NumPy ndarray."""
         ...
 
+    @classmethod
+    def from_dlpack(cls, tensor: Any, align: bool = False) -> "SparrowArrayType":
+        """Create a SparrowArray from a DLPack tensor."""
+        ...
+
 
 def _get_module_name_from_path(file_path: Path) -> str:
     """Extract the module name from a .so/.pyd file path.
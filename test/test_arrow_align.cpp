@@ -0,0 +1,174 @@
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <sparrow-rockfinch/arrow_align.hpp>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/primitive_array.hpp>
+#include <sparrow/utils/nullable.hpp>
+
+#include "arrow_test_fixtures.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        using test::make_array;
+        using test::make_schema;
+
+        bool is_aligned(const void* buffer)
+        {
+            return reinterpret_cast<std::uintptr_t>(buffer) % 64 == 0;
+        }
+
+        template <typename T>
+        const T* buffer_of(const ArrowArray& array, std::size_t index)
+        {
+            return static_cast<const T*>(array.buffers[index]);
+        }
+    }
+
+    TEST_SUITE("arrow_align")
+    {
+        TEST_CASE("keeps_aligned_arrays")
+        {
+            sparrow::array numbers(sparrow::primitive_array<int32_t>(std::vector<int32_t>{1, 2, 3}));
+            const ArrowArray& array = *sparrow::get_arrow_array(numbers);
+            CHECK_FALSE(needs_realignment(array));
+            CHECK_FALSE(realign_array(array, *sparrow::get_arrow_schema(numbers), nullptr).has_value());
+        }
+
+        TEST_CASE("primitive")
+        {
+            alignas(64) static std::int32_t storage[9] = {0, 0, 10, 20, 30, 40, 50, 60, 70};
+            alignas(64) static std::uint8_t validity[] = {0b11011111};
+            ArrowSchema schema = make_schema("i");
+
+            SUBCASE("offset")
+            {
+                std::vector<const void*> buffers = {validity, storage + 1};
+                ArrowArray array = make_array(5, buffers, 3);
+                array.null_count = 1;
+                REQUIRE(needs_realignment(array));
+
+                std::optional<sparrow::array> result = realign_array(array, schema, nullptr);
+                REQUIRE(result.has_value());
+                const ArrowArray& realigned = *sparrow::get_arrow_array(*result);
+                CHECK_EQ(realigned.offset, 0);
+                CHECK_EQ(realigned.length, 5);
+                CHECK_EQ(realigned.null_count, 1);
+                CHECK(is_aligned(realigned.buffers[0]));
+                CHECK(is_aligned(realigned.buffers[1]));
+                CHECK_EQ(buffer_of<std::uint8_t>(realigned, 0)[0], 0b11011);
+                const std::int32_t* data = buffer_of<std::int32_t>(realigned, 1);
+                const std::vector<std::int32_t> expected = {30, 40, 50, 60, 70};
+                CHECK_EQ(std::vector<std::int32_t>(data, data + 5), expected);
+                CHECK_FALSE(needs_realignment(realigned));
+            }
+
+            SUBCASE("misaligned_buffer")
+            {
+                std::vector<const void*> buffers = {nullptr, storage + 2};
+                ArrowArray array = make_array(3, buffers);
+                REQUIRE(needs_realignment(array));
+
+                std::optional<sparrow::array> result = realign_array(array, schema, nullptr);
+                REQUIRE(result.has_value());
+                const ArrowArray& realigned = *sparrow::get_arrow_array(*result);
+                CHECK(is_aligned(realigned.buffers[1]));
+                CHECK_EQ(buffer_of<std::int32_t>(realigned, 1)[0], 10);
+                CHECK_EQ(realigned.null_count, 0);
+            }
+        }
+
+        TEST_CASE("string_offsets_are_rebased")
+        {
+            alignas(64) static std::int32_t offsets[] = {0, 1, 3, 6};
+            alignas(64) static char data[] = "abbccc";
+            std::vector<const void*> buffers = {nullptr, offsets, data};
+            ArrowArray array = make_array(2, buffers, 1);
+            ArrowSchema schema = make_schema("u");
+
+            std::optional<sparrow::array> result = realign_array(array, schema, nullptr);
+            REQUIRE(result.has_value());
+            const ArrowArray& realigned = *sparrow::get_arrow_array(*result);
+            const std::int32_t* new_offsets = buffer_of<std::int32_t>(realigned, 1);
+            const std::vector<std::int32_t> expected = {0, 2, 5};
+            CHECK_EQ(std::vector<std::int32_t>(new_offsets, new_offsets + 3), expected);
+            CHECK_EQ(std::string_view(buffer_of<char>(realigned, 2), 5), "bbccc");
+            CHECK(is_aligned(realigned.buffers[2]));
+        }
+
+        TEST_CASE("copy_owns_every_buffer")
+        {
+            alignas(64) static std::int32_t storage[] = {10, 20, 30, 40};
+            alignas(64) static std::uint8_t validity[] = {0b1101};
+            std::vector<const void*> buffers = {validity, storage};
+            ArrowArray array = make_array(3, buffers, 1);
+            array.null_count = 1;
+            ArrowSchema schema = make_schema("i");
+            CHECK_FALSE(owns_all_buffers(array));
+
+            std::optional<sparrow::array> result = copy_array(array, schema);
+            REQUIRE(result.has_value());
+            const ArrowArray& copied = *sparrow::get_arrow_array(*result);
+            CHECK(owns_all_buffers(copied));
+            CHECK_EQ(copied.offset, 0);
+            CHECK_EQ(copied.null_count, 1);
+            CHECK_EQ(buffer_of<std::uint8_t>(copied, 0)[0] & 0b111, 0b110);
+            const std::int32_t* data = buffer_of<std::int32_t>(copied, 1);
+            const std::vector<std::int32_t> expected = {20, 30, 40};
+            CHECK_EQ(std::vector<std::int32_t>(data, data + 3), expected);
+
+            // Aligned buffers are copied too, unlike with realign_array
+            std::vector<const void*> aligned_buffers = {nullptr, storage};
+            ArrowArray aligned = make_array(4, aligned_buffers);
+            std::optional<sparrow::array> aligned_copy = copy_array(aligned, schema);
+            REQUIRE(aligned_copy.has_value());
+            CHECK_NE(sparrow::get_arrow_array(*aligned_copy)->buffers[1], static_cast<const void*>(storage));
+            CHECK(owns_all_buffers(*sparrow::get_arrow_array(*aligned_copy)));
+
+            // A realigned array still shares its aligned buffers (here the validity bitmap)
+            std::vector<const void*> misaligned_buffers = {validity, storage + 1};
+            ArrowArray misaligned = make_array(3, misaligned_buffers);
+            misaligned.null_count = 1;
+            std::optional<sparrow::array> realigned = realign_array(misaligned, schema, nullptr);
+            REQUIRE(realigned.has_value());
+            CHECK_FALSE(owns_all_buffers(*sparrow::get_arrow_array(*realigned)));
+        }
+
+        TEST_CASE("unsupported_layouts_are_left_alone")
+        {
+            alignas(64) static std::int8_t type_ids[] = {0, 0};
+            std::vector<const void*> buffers = {type_ids};
+            ArrowArray array = make_array(1, buffers, 1);
+            ArrowSchema schema = make_schema("+us:");
+            CHECK_FALSE(realign_array(array, schema, nullptr).has_value());
+        }
+
+        TEST_CASE("stats")
+        {
+            reset_realign_stats();
+            alignas(64) static std::int64_t storage[] = {1, 2, 3};
+            std::vector<const void*> buffers = {nullptr, storage};
+            ArrowSchema schema = make_schema("l");
+
+            ArrowArray aligned = make_array(3, buffers);
+            CHECK_FALSE(realign_array(aligned, schema, nullptr).has_value());
+            ArrowArray sliced = make_array(2, buffers, 1);
+            CHECK(realign_array(sliced, schema, nullptr).has_value());
+
+            const realign_stats stats = get_realign_stats();
+            CHECK_EQ(stats.arrays_checked, 2);
+            CHECK_EQ(stats.arrays_realigned, 1);
+            CHECK_EQ(stats.buffers_copied, 1);
+            CHECK_EQ(stats.bytes_copied, 2 * sizeof(std::int64_t));
+
+            reset_realign_stats();
+            CHECK_EQ(get_realign_stats().arrays_checked, 0);
+        }
+    }
+}
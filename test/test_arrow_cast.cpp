@@ -0,0 +1,157 @@
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sparrow-rockfinch/arrow_cast.hpp>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/primitive_array.hpp>
+#include <sparrow/string_array.hpp>
+#include <sparrow/utils/nullable.hpp>
+
+#include "doctest/doctest.h"
+
+namespace sparrow::rockfinch
+{
+    namespace
+    {
+        std::shared_ptr<const sparrow::array> make_int32_cast_source(int32_t last_value)
+        {
+            std::vector<sparrow::nullable<int32_t>> values = {
+                sparrow::make_nullable<int32_t>(1, true),
+                sparrow::make_nullable<int32_t>(-2, true),
+                sparrow::make_nullable<int32_t>(0, false),  // null value
+                sparrow::make_nullable<int32_t>(last_value, true)
+            };
+            sparrow::primitive_array<int32_t> prim_array(std::move(values));
+            return std::make_shared<const sparrow::array>(std::move(prim_array));
+        }
+
+        ArrowSchema make_requested_schema(const char* format)
+        {
+            ArrowSchema schema{};
+            schema.format = format;
+            schema.flags = ARROW_FLAG_NULLABLE;
+            return schema;
+        }
+    }
+
+    TEST_SUITE("arrow_cast")
+    {
+        TEST_CASE("has_same_layout")
+        {
+            ArrowSchema int32_schema = make_requested_schema("i");
+            ArrowSchema other_int32_schema = make_requested_schema("i");
+            other_int32_schema.name = "renamed";
+            ArrowSchema int64_schema = make_requested_schema("l");
+
+            CHECK(has_same_layout(int32_schema, other_int32_schema));
+            CHECK_FALSE(has_same_layout(int32_schema, int64_schema));
+        }
+
+        TEST_CASE("can_cast")
+        {
+            ArrowSchema int32_schema = make_requested_schema("i");
+            ArrowSchema int8_schema = make_requested_schema("c");
+            ArrowSchema float64_schema = make_requested_schema("g");
+            ArrowSchema utf8_schema = make_requested_schema("u");
+            ArrowSchema large_utf8_schema = make_requested_schema("U");
+
+            CHECK(can_cast(int32_schema, int32_schema));
+            // Checked against the values by cast_array
+            CHECK(can_cast(int32_schema, int8_schema));
+            CHECK(can_cast(int32_schema, float64_schema));
+            CHECK_FALSE(can_cast(float64_schema, int32_schema));
+            CHECK(can_cast(utf8_schema, large_utf8_schema));
+            CHECK_FALSE(can_cast(utf8_schema, int32_schema));
+        }
+
+        TEST_CASE("cast_array")
+        {
+            SUBCASE("widens_integers")
+            {
+                auto source = make_int32_cast_source(4);
+                ArrowSchema requested = make_requested_schema("l");
+
+                std::optional<sparrow::array> cast = cast_array(source, requested);
+                REQUIRE(cast.has_value());
+                CHECK_EQ(cast->data_type(), sparrow::data_type::INT64);
+                CHECK_EQ(cast->size(), 4);
+                CHECK_EQ(cast->null_count(), 1);
+
+                const ArrowArray* cast_arrow_array = sparrow::get_arrow_array(*cast);
+                const auto* values = static_cast<const int64_t*>(cast_arrow_array->buffers[1]);
+                CHECK_EQ(values[0], 1);
+                CHECK_EQ(values[1], -2);
+                CHECK_EQ(values[3], 4);
+
+                // The validity bitmap is shared with the source
+                CHECK_EQ(cast_arrow_array->buffers[0], sparrow::get_arrow_array(*source)->buffers[0]);
+            }
+
+            SUBCASE("narrows_integers_that_fit")
+            {
+                auto source = make_int32_cast_source(100);
+                ArrowSchema requested = make_requested_schema("c");
+
+                std::optional<sparrow::array> cast = cast_array(source, requested);
+                REQUIRE(cast.has_value());
+                CHECK_EQ(cast->data_type(), sparrow::data_type::INT8);
+                const auto* values = static_cast<const int8_t*>(sparrow::get_arrow_array(*cast)->buffers[1]);
+                CHECK_EQ(values[3], 100);
+            }
+
+            SUBCASE("rejects_lossy_narrowing")
+            {
+                auto source = make_int32_cast_source(100000);
+                ArrowSchema requested = make_requested_schema("s");
+
+                CHECK_FALSE(cast_array(source, requested).has_value());
+            }
+
+            SUBCASE("rejects_unsupported_cast")
+            {
+                auto source = make_int32_cast_source(4);
+                ArrowSchema requested = make_requested_schema("u");
+
+                CHECK_FALSE(cast_array(source, requested).has_value());
+            }
+
+            SUBCASE("widens_string_offsets")
+            {
+                sparrow::string_array strings(std::vector<std::string>{"a", "bb", "ccc"});
+                auto source = std::make_shared<const sparrow::array>(std::move(strings));
+                ArrowSchema requested = make_requested_schema("U");
+
+                std::optional<sparrow::array> cast = cast_array(source, requested);
+                REQUIRE(cast.has_value());
+                CHECK_EQ(cast->data_type(), sparrow::data_type::LARGE_STRING);
+
+                const ArrowArray* cast_arrow_array = sparrow::get_arrow_array(*cast);
+                const auto* offsets = static_cast<const int64_t*>(cast_arrow_array->buffers[1]);
+                CHECK_EQ(offsets[3] - offsets[0], 6);
+
+                // The character data is shared with the source
+                CHECK_EQ(cast_arrow_array->buffers[2], sparrow::get_arrow_array(*source)->buffers[2]);
+            }
+
+            SUBCASE("keeps_source_alive")
+            {
+                auto source = make_int32_cast_source(4);
+                ArrowSchema requested = make_requested_schema("g");
+
+                std::optional<sparrow::array> cast = cast_array(source, requested);
+                REQUIRE(cast.has_value());
+                std::weak_ptr<const sparrow::array> weak_source = source;
+                source.reset();
+                CHECK_FALSE(weak_source.expired());
+
+                cast.reset();
+                CHECK(weak_source.expired());
+            }
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sparrow-rockfinch/arrow_validate.hpp>
+
+#include <sparrow/array.hpp>
+#include <sparrow/c_interface.hpp>
+#include <sparrow/primitive_array.hpp>
+#include <sparrow/string_array.hpp>
+#include <sparrow/utils/nullable.hpp>
+
+#include "arrow_test_fixtures.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow::rockfinch
+{
+    using test::make_array;
+    using test::make_schema;
+
+    TEST_SUITE("arrow_validate")
+    {
+        TEST_CASE("accepts_sparrow_arrays")
+        {
+            std::vector<sparrow::nullable<int32_t>> values = {
+                sparrow::make_nullable<int32_t>(1, true),
+                sparrow::make_nullable<int32_t>(0, false),
+                sparrow::make_nullable<int32_t>(3, true)
+            };
+            sparrow::array numbers(sparrow::primitive_array<int32_t>(std::move(values)));
+            CHECK_FALSE(validate_arrow_array(*sparrow::get_arrow_array(numbers), *sparrow::get_arrow_schema(numbers)));
+
+            sparrow::array strings(sparrow::string_array(std::vector<std::string>{"ascii", "d\xc3\xa9j\xc3\xa0", ""}));
+            CHECK_FALSE(validate_arrow_array(*sparrow::get_arrow_array(strings), *sparrow::get_arrow_schema(strings)));
+        }
+
+        TEST_CASE("structure")
+        {
+            const std::int32_t data[] = {1, 2, 3, 4};
+            const std::uint8_t validity[] = {0b1011};
+            std::vector<const void*> buffers = {validity, data};
+            ArrowSchema schema = make_schema("i");
+
+            SUBCASE("null_count_matches_bitmap")
+            {
+                ArrowArray array = make_array(4, buffers, 0, 1);
+                CHECK_FALSE(validate_arrow_array(array, schema));
+                array.offset = 1;
+                array.length = 3;
+                CHECK_FALSE(validate_arrow_array(array, schema));
+                array.null_count = -1;
+                CHECK_FALSE(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("wrong_null_count")
+            {
+                ArrowArray array = make_array(4, buffers, 0, 2);
+                CHECK(validate_arrow_array(array, schema));
+                array.null_count = 5;
+                CHECK(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("wrong_buffer_count")
+            {
+                std::vector<const void*> three_buffers = {validity, data, data};
+                ArrowArray array = make_array(4, three_buffers, 0, 1);
+                CHECK(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("released_array")
+            {
+                ArrowArray array = make_array(4, buffers, 0, 1);
+                array.release = nullptr;
+                CHECK(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("unknown_format")
+            {
+                ArrowSchema unknown = make_schema("?");
+                ArrowArray array = make_array(4, buffers, 0, 1);
+                CHECK(validate_arrow_array(array, unknown));
+            }
+        }
+
+        TEST_CASE("offsets_and_utf8")
+        {
+            ArrowSchema utf8 = make_schema("u");
+            ArrowSchema binary = make_schema("z");
+
+            SUBCASE("decreasing_offsets")
+            {
+                const std::int32_t offsets[] = {0, 3, 2, 5};
+                std::vector<const void*> buffers = {nullptr, offsets, "abcde"};
+                ArrowArray array = make_array(3, buffers);
+                const auto error = validate_arrow_array(array, utf8);
+                REQUIRE(error);
+                CHECK_NE(error->find("offsets"), std::string::npos);
+            }
+
+            SUBCASE("invalid_utf8")
+            {
+                // The second value is a truncated 3-byte sequence
+                const std::int32_t offsets[] = {0, 3, 5};
+                std::vector<const void*> buffers = {nullptr, offsets, "a\xc3\xa9\xe2\x82"};
+                ArrowArray array = make_array(2, buffers);
+                const auto error = validate_arrow_array(array, utf8);
+                REQUIRE(error);
+                CHECK_NE(error->find("UTF-8"), std::string::npos);
+                // Binary data is not UTF-8 checked
+                CHECK_FALSE(validate_arrow_array(array, binary));
+            }
+
+            SUBCASE("invalid_utf8_in_null_slot_is_ignored")
+            {
+                const std::int32_t offsets[] = {0, 3, 5};
+                const std::uint8_t validity[] = {0b01};
+                std::vector<const void*> buffers = {validity, offsets, "a\xc3\xa9\xe2\x82"};
+                ArrowArray array = make_array(2, buffers, 0, 1);
+                CHECK_FALSE(validate_arrow_array(array, utf8));
+            }
+
+            SUBCASE("overlong_and_surrogate_sequences")
+            {
+                const std::int32_t offsets[] = {0, 2};
+                std::vector<const void*> overlong = {nullptr, offsets, "\xc0\x80"};
+                CHECK(validate_arrow_array(make_array(1, overlong), utf8));
+
+                const std::int32_t surrogate_offsets[] = {0, 3};
+                std::vector<const void*> surrogate = {nullptr, surrogate_offsets, "\xed\xa0\x80"};
+                CHECK(validate_arrow_array(make_array(1, surrogate), utf8));
+            }
+        }
+
+        TEST_CASE("nested")
+        {
+            const std::int32_t data[] = {1, 2, 3};
+            std::vector<const void*> child_buffers = {nullptr, data};
+            ArrowArray child = make_array(2, child_buffers);
+            ArrowSchema child_schema = make_schema("i");
+            ArrowArray* children[] = {&child};
+            ArrowSchema* child_schemas[] = {&child_schema};
+
+            SUBCASE("struct_child_too_short")
+            {
+                std::vector<const void*> buffers = {nullptr};
+                ArrowArray array = make_array(3, buffers);
+                array.n_children = 1;
+                array.children = children;
+                ArrowSchema schema = make_schema("+s");
+                schema.n_children = 1;
+                schema.children = child_schemas;
+
+                CHECK(validate_arrow_array(array, schema));
+                array.length = 2;
+                CHECK_FALSE(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("list_offsets_past_child")
+            {
+                const std::int32_t offsets[] = {0, 1, 3};
+                std::vector<const void*> buffers = {nullptr, offsets};
+                ArrowArray array = make_array(2, buffers);
+                array.n_children = 1;
+                array.children = children;
+                ArrowSchema schema = make_schema("+l");
+                schema.n_children = 1;
+                schema.children = child_schemas;
+
+                CHECK(validate_arrow_array(array, schema));
+                child.length = 3;
+                CHECK_FALSE(validate_arrow_array(array, schema));
+            }
+
+            SUBCASE("dictionary_index_out_of_range")
+            {
+                const std::int8_t indices[] = {0, 1, 2};
+                std::vector<const void*> buffers = {nullptr, indices};
+                ArrowArray array = make_array(3, buffers);
+                array.dictionary = &child;
+                ArrowSchema schema = make_schema("c");
+                schema.dictionary = &child_schema;
+
+                CHECK(validate_arrow_array(array, schema));
+                child.length = 3;
+                CHECK_FALSE(validate_arrow_array(array, schema));
+            }
+        }
+    }
+}
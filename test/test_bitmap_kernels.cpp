@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <sparrow-rockfinch/detail/bitmap_kernels.hpp>
+
+#include "doctest/doctest.h"
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        std::vector<std::uint8_t> make_bitmap(std::size_t n_bytes)
+        {
+            std::vector<std::uint8_t> bitmap(n_bytes);
+            std::uint32_t state = 12345;
+            for (auto& byte : bitmap)
+            {
+                state = state * 1103515245u + 12345u;
+                byte = static_cast<std::uint8_t>(state >> 16);
+            }
+            return bitmap;
+        }
+    }
+
+    TEST_SUITE("bitmap_kernels")
+    {
+        TEST_CASE("unpack_bits")
+        {
+            // Long enough to go through the vector kernels and their tails
+            const std::vector<std::uint8_t> bitmap = make_bitmap(64);
+            for (const bool invert : {false, true})
+            {
+                for (std::size_t offset = 0; offset < 17; ++offset)
+                {
+                    for (std::size_t length = 0; length < 300; length += 7)
+                    {
+                        std::vector<std::uint8_t> out(length + 1, 0x2A);
+                        unpack_bits(bitmap.data(), offset, length, reinterpret_cast<bool*>(out.data()), invert);
+                        for (std::size_t i = 0; i < length; ++i)
+                        {
+                            REQUIRE(out[i] == ((bit_is_set(bitmap.data(), offset + i) != invert) ? 1 : 0));
+                        }
+                        // Nothing is written past the end
+                        REQUIRE(out[length] == 0x2A);
+                    }
+                }
+            }
+        }
+
+        TEST_CASE("pack_bits")
+        {
+            // Bytes other than 0 and 1 are true as well
+            std::vector<std::uint8_t> bytes = make_bitmap(300);
+            for (auto& byte : bytes)
+            {
+                byte = (byte % 3 == 0) ? 0 : byte;
+            }
+            for (const bool invert : {false, true})
+            {
+                for (std::size_t length = 0; length < 300; length += 7)
+                {
+                    std::vector<std::uint8_t> out((length + 7) / 8 + 1, 0xFF);
+                    const std::size_t count = pack_bits(bytes.data(), length, out.data(), invert);
+                    std::size_t expected_count = 0;
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        const bool expected = (bytes[i] != 0) != invert;
+                        expected_count += expected ? 1 : 0;
+                        REQUIRE(bit_is_set(out.data(), i) == expected);
+                    }
+                    REQUIRE(count == expected_count);
+                    // The unused bits of the last byte are cleared, nothing is written past it
+                    for (std::size_t i = length; i < 8 * ((length + 7) / 8); ++i)
+                    {
+                        REQUIRE_FALSE(bit_is_set(out.data(), i));
+                    }
+                    REQUIRE(out[(length + 7) / 8] == 0xFF);
+                }
+            }
+        }
+
+        TEST_CASE("pack_not_equal")
+        {
+            constexpr std::int64_t nat = std::numeric_limits<std::int64_t>::min();
+            const std::vector<std::uint8_t> pattern = make_bitmap(300);
+            std::vector<std::int64_t> values(pattern.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = pattern[i] % 3 == 0 ? nat : static_cast<std::int64_t>(i) - 150;
+            }
+            for (std::size_t length = 0; length < 300; length += 7)
+            {
+                std::vector<std::uint8_t> out((length + 7) / 8 + 1, 0xFF);
+                const std::size_t count = pack_not_equal(values.data(), length, nat, out.data());
+                std::size_t expected_count = 0;
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    const bool expected = values[i] != nat;
+                    expected_count += expected ? 1 : 0;
+                    REQUIRE(bit_is_set(out.data(), i) == expected);
+                }
+                REQUIRE(count == expected_count);
+                for (std::size_t i = length; i < 8 * ((length + 7) / 8); ++i)
+                {
+                    REQUIRE_FALSE(bit_is_set(out.data(), i));
+                }
+                REQUIRE(out[(length + 7) / 8] == 0xFF);
+            }
+        }
+
+        TEST_CASE("fill_unset_bits")
+        {
+            // Mostly valid, with runs of nulls, to go through skipped and partial words
+            std::vector<std::uint8_t> bitmap = make_bitmap(64);
+            for (std::size_t i = 0; i < bitmap.size(); ++i)
+            {
+                bitmap[i] = (i % 5 == 0) ? bitmap[i] : 0xFF;
+            }
+            for (std::size_t offset = 0; offset < 17; ++offset)
+            {
+                for (std::size_t length = 0; length < 300; length += 7)
+                {
+                    std::vector<double> values(length + 1, 1.0);
+                    fill_unset_bits(bitmap.data(), offset, length, values.data(), -1.0);
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        REQUIRE(values[i] == (bit_is_set(bitmap.data(), offset + i) ? 1.0 : -1.0));
+                    }
+                    REQUIRE(values[length] == 1.0);
+                }
+            }
+        }
+    }
+}
@@ -7,16 +7,35 @@ This module contains reusable test classes to avoid duplication:
 - TestSparrowStreamWithPolars: Tests for SparrowStream with Polars
 """
 
+import struct
+
 import polars as pl
 import pyarrow as pa
+import pytest
 from polars._plr import PySeries
 from polars._utils.wrap import wrap_s
 
 # Import sparrow_rockfinch module (try release first, then debug)
 try:
-    from sparrow_rockfinch import SparrowArray, SparrowStream
+    from sparrow_rockfinch import (
+        SparrowArray,
+        SparrowStream,
+        capsule_pool_stats,
+        import_arrays_from_capsules,
+        realign_stats,
+        reset_capsule_pool_stats,
+        reset_realign_stats,
+    )
 except ImportError:
-    from sparrow_rockfinchd import SparrowArray, SparrowStream
+    from sparrow_rockfinchd import (
+        SparrowArray,
+        SparrowStream,
+        capsule_pool_stats,
+        import_arrays_from_capsules,
+        realign_stats,
+        reset_capsule_pool_stats,
+        reset_realign_stats,
+    )
 
 
 def arrow_array_to_series(
@@ -121,6 +140,237 @@ class TestPyArrowToSparrow:
         assert values[3] == 3, "Value changed at index 3"
         assert values[4] is None, "Null not preserved at index 4"
 
+    def test_import_arrays_from_capsules_batch(self):
+        """Import several capsule pairs in a single call."""
+        sources = [
+            pa.array([1, 2, None], type=pa.int32()),
+            pa.array(["a", None, "c", "d"], type=pa.string()),
+            pa.array([1.5, 2.5], type=pa.float64()),
+        ]
+
+        arrays = import_arrays_from_capsules([src.__arrow_c_array__() for src in sources])
+
+        assert len(arrays) == 3
+        assert [len(arr) for arr in arrays] == [3, 4, 2]
+        for arr, src in zip(arrays, sources):
+            assert arrow_array_to_series(arr).to_list() == src.to_pylist()
+
+    def test_import_arrays_from_capsules_shared_schema(self):
+        """Pairs sharing one schema capsule each get a usable schema."""
+        first = pa.array([1, 2, 3], type=pa.int64())
+        second = pa.array([4, 5], type=pa.int64())
+        schema_capsule, first_array = first.__arrow_c_array__()
+        _, second_array = second.__arrow_c_array__()
+
+        arrays = import_arrays_from_capsules([(schema_capsule, first_array), (schema_capsule, second_array)])
+
+        assert arrow_array_to_series(arrays[0]).to_list() == [1, 2, 3]
+        assert arrow_array_to_series(arrays[1]).to_list() == [4, 5]
+
+    def test_import_arrays_from_capsules_rejects_invalid_batch(self):
+        """An invalid pair fails the whole batch without consuming the others."""
+        valid = pa.array([1, 2, 3], type=pa.int32()).__arrow_c_array__()
+        schema_capsule, _ = pa.array([4], type=pa.int32()).__arrow_c_array__()
+
+        with pytest.raises(ValueError):
+            import_arrays_from_capsules([valid, (schema_capsule, schema_capsule)])
+
+        # The valid pair was not consumed and can still be imported
+        arrays = import_arrays_from_capsules([valid])
+        assert arrow_array_to_series(arrays[0]).to_list() == [1, 2, 3]
+
+    def test_capsule_pool_reuses_released_structures(self):
+        """Capsule structures released by consumers are reused by later exports."""
+        sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int32()))
+        pa.array(sparrow_array)
+
+        reset_capsule_pool_stats()
+        for _ in range(10):
+            pa.array(sparrow_array)
+
+        stats = capsule_pool_stats()
+        assert set(stats) == {"schema", "array", "stream", "device_array", "device_stream"}
+        assert stats["array"]["hits"] >= 10
+        assert stats["schema"]["hits"] >= 10
+        assert stats["array"]["misses"] == 0
+
+    def test_repeated_export_shares_buffers(self):
+        """Exporting a SparrowArray several times does not copy its buffers."""
+        pa_array = pa.array([1, 2, None, 4, 5], type=pa.int32())
+        sparrow_array = SparrowArray.from_arrow(pa_array)
+
+        first = pa.array(sparrow_array)
+        second = pa.array(sparrow_array)
+
+        assert first.buffers()[1].address == second.buffers()[1].address
+        assert first.buffers()[0].address == second.buffers()[0].address
+
+        # Exports stay valid after the SparrowArray is gone
+        del sparrow_array
+        assert first.to_pylist() == [1, 2, None, 4, 5]
+        assert second.to_pylist() == [1, 2, None, 4, 5]
+
+    @pytest.mark.skipif(
+        not hasattr(pa.Array, "_import_from_c_device_capsule"),
+        reason="requires pyarrow with the Arrow C Device Data Interface",
+    )
+    def test_device_array_export_is_cpu_and_zero_copy(self):
+        """__arrow_c_device_array__ exports CPU data sharing the same buffers."""
+        sparrow_array = SparrowArray.from_arrow(pa.array([1, None, 3], type=pa.int32()))
+
+        schema_capsule, device_array_capsule = sparrow_array.__arrow_c_device_array__()
+        result = pa.Array._import_from_c_device_capsule(schema_capsule, device_array_capsule)
+
+        assert result.to_pylist() == [1, None, 3]
+        assert result.buffers()[1].address == pa.array(sparrow_array).buffers()[1].address
+
+    def test_device_array_rejects_unknown_keywords(self):
+        """Protocol keywords set to a non-None value are not supported."""
+        sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int32()))
+
+        sparrow_array.__arrow_c_device_array__(future_option=None)
+        with pytest.raises(NotImplementedError):
+            sparrow_array.__arrow_c_device_array__(future_option=True)
+
+    def test_from_arrow_accepts_device_only_producers(self):
+        """Objects exposing only __arrow_c_device_array__ can be imported."""
+
+        class DeviceOnly:
+            def __init__(self, source):
+                self._source = source
+
+            def __arrow_c_device_array__(self, requested_schema=None, **kwargs):
+                return self._source.__arrow_c_device_array__(requested_schema, **kwargs)
+
+        source = SparrowArray.from_arrow(pa.array([4, None, 6], type=pa.int64()))
+        sparrow_array = SparrowArray.from_arrow(DeviceOnly(source))
+
+        assert len(sparrow_array) == 3
+        assert arrow_array_to_series(sparrow_array).to_list() == [4, None, 6]
+
+    def test_requested_schema_casts_to_requested_type(self):
+        """requested_schema produces the requested layout."""
+        sparrow_array = SparrowArray.from_arrow(pa.array([1, None, 3], type=pa.int32()))
+
+        schema_capsule, array_capsule = sparrow_array.__arrow_c_array__(pa.int64().__arrow_c_schema__())
+        result = pa.Array._import_from_c_capsule(schema_capsule, array_capsule)
+
+        assert result.type == pa.int64()
+        assert result.to_pylist() == [1, None, 3]
+
+    def test_requested_schema_casts_strings_to_large_strings(self):
+        """utf8 arrays can be exported as large_utf8 and back."""
+        sparrow_array = SparrowArray.from_arrow(pa.array(["a", None, "ccc"])[1:])
+
+        large = pa.array(sparrow_array, type=pa.large_string())
+        assert large.type == pa.large_string()
+        assert large.to_pylist() == [None, "ccc"]
+
+        back = pa.array(SparrowArray.from_arrow(large), type=pa.string())
+        assert back.type == pa.string()
+        assert back.to_pylist() == [None, "ccc"]
+
+    def test_requested_schema_falls_back_to_native_layout(self):
+        """Impossible casts export the native layout."""
+        sparrow_array = SparrowArray.from_arrow(pa.array([1, 100000], type=pa.int32()))
+
+        schema_capsule, array_capsule = sparrow_array.__arrow_c_array__(pa.int16().__arrow_c_schema__())
+        result = pa.Array._import_from_c_capsule(schema_capsule, array_capsule)
+
+        assert result.type == pa.int32()
+        assert result.to_pylist() == [1, 100000]
+
+    def test_validate_full_accepts_valid_arrays(self):
+        """validate="full" imports well-formed arrays unchanged."""
+        for pa_array in (
+            pa.array([1, None, 3], type=pa.int32()),
+            pa.array(["a", None, "déjà vu"])[1:],
+            pa.array([[1], None, [2, 3]]),
+            pa.array(["x", "y", "x"]).dictionary_encode(),
+        ):
+            sparrow_array = SparrowArray.from_arrow(pa_array, validate="full")
+            assert pa.array(sparrow_array).to_pylist() == pa_array.to_pylist()
+
+    def test_validate_full_rejects_malformed_arrays(self):
+        """validate="full" raises ValueError on malformed offsets or UTF-8."""
+        bad_utf8 = pa.Array.from_buffers(
+            pa.string(), 2, [None, pa.py_buffer(struct.pack("<3i", 0, 1, 3)), pa.py_buffer(b"a\xff\xfe")]
+        )
+        bad_offsets = pa.Array.from_buffers(
+            pa.binary(), 3, [None, pa.py_buffer(struct.pack("<4i", 0, 3, 2, 5)), pa.py_buffer(b"abcde")]
+        )
+
+        with pytest.raises(ValueError, match="UTF-8"):
+            SparrowArray.from_arrow(bad_utf8, validate="full")
+        with pytest.raises(ValueError, match="offsets"):
+            SparrowArray.from_arrow(bad_offsets, validate="full", lazy=True)
+
+    def test_validate_rejects_unknown_mode(self):
+        """Only "trusted" and "full" are accepted."""
+        with pytest.raises(ValueError):
+            SparrowArray.from_arrow(pa.array([1, 2, 3]), validate="sometimes")
+
+    def test_lazy_import_defers_materialization(self):
+        """len(), the schema and re-export of a lazy array do not build it."""
+        pa_array = pa.array([1, None, 3], type=pa.int32())
+        sparrow_array = SparrowArray.from_arrow(pa_array, lazy=True)
+
+        assert not sparrow_array.is_materialized()
+        assert len(sparrow_array) == 3
+        assert pa.DataType._import_from_c_capsule(sparrow_array.__arrow_c_schema__()) == pa.int32()
+        schema_capsule, array_capsule = sparrow_array.__arrow_c_array__()
+        result = pa.Array._import_from_c_capsule(schema_capsule, array_capsule)
+        large = pa.array(sparrow_array, type=pa.int64())
+
+        assert not sparrow_array.is_materialized()
+        assert result.to_pylist() == [1, None, 3]
+        assert result.buffers()[1].address == pa_array.buffers()[1].address
+        assert large.to_pylist() == [1, None, 3]
+
+    def test_lazy_import_materializes_on_typed_access(self):
+        """Typed access builds the array once; earlier exports stay valid."""
+        pa_array = pa.array([1.5, 2.5, 3.5], type=pa.float64())
+        sparrow_array = SparrowArray.from_arrow(pa_array, lazy=True)
+        exported = pa.array(sparrow_array)
+
+        assert sparrow_array.to_numpy().tolist() == [1.5, 2.5, 3.5]
+        assert sparrow_array.is_materialized()
+        assert pa.array(sparrow_array).buffers()[1].address == exported.buffers()[1].address
+
+        del sparrow_array
+        assert exported.to_pylist() == [1.5, 2.5, 3.5]
+
+    def test_align_realigns_sliced_arrays(self):
+        """align=True copies offset buffers into 64-byte aligned storage."""
+        pa_array = pa.array([1, 2, None, 4, 5, 6], type=pa.int32()).slice(1, 4)
+        reset_realign_stats()
+        sparrow_array = SparrowArray.from_arrow(pa_array, align=True)
+
+        result = pa.array(sparrow_array)
+        assert result.to_pylist() == [2, None, 4, 5]
+        assert result.offset == 0
+        assert all(buffer.address % 64 == 0 for buffer in result.buffers())
+
+        stats = realign_stats()
+        assert stats["arrays_checked"] == 1
+        assert stats["arrays_realigned"] == 1
+        assert stats["bytes_copied"] >= 4 * 4
+
+    def test_align_shares_aligned_arrays(self):
+        """align=True does not copy buffers that are already aligned."""
+        pa_array = pa.array(["a", "bc", None], type=pa.string())
+        reset_realign_stats()
+        sparrow_array = SparrowArray.from_arrow(pa_array, align=True, lazy=True)
+
+        assert not sparrow_array.is_materialized()
+        assert pa.array(sparrow_array).buffers()[2].address == pa_array.buffers()[2].address
+        assert realign_stats() == {
+            "arrays_checked": 1,
+            "arrays_realigned": 0,
+            "buffers_copied": 0,
+            "bytes_copied": 0,
+        }
+
 
 # =============================================================================
 # Test: SparrowStream with Polars DataFrame and Series
@@ -1,5 +1,7 @@
 from __future__ import annotations
 
+import datetime
+
 import numpy as np
 import pyarrow as pa
 import pytest
@@ -23,6 +25,7 @@ except ImportError:
         (np.uint16, [100, 200, 300, 400]),
         (np.uint32, [5, 6, 7, 8]),
         (np.uint64, [1000, 2000, 3000, 4000]),
+        (np.float16, [0.5, 1.5, 2.5, 3.5]),
         (np.float32, [1.5, 2.5, 3.5, 4.5]),
         (np.float64, [9.5, 8.5, 7.5, 6.5]),
         (np.bool_, [True, False, True, True]),
@@ -182,6 +185,27 @@ def test_bool_from_ndarray_mutation_does_not_propagate():
     assert np.asarray(sparrow_array).tolist() == [True, False, True]
 
 
+def test_bool_from_ndarray_packs_into_arrow_bitmap():
+    """Bool arrays of any length are packed into an Arrow bitmap."""
+    values = [(i * 5) % 7 < 3 for i in range(1003)]
+    source = np.array(values, dtype=np.bool_)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.type == pa.bool_()
+    assert result.null_count == 0
+    assert result.to_pylist() == values
+    assert result.buffers()[1].address % 64 == 0
+
+
+def test_bool_from_ndarray_treats_nonzero_bytes_as_true():
+    """Non-canonical bool_ bytes (e.g. from a uint8 view) are true."""
+    source = np.array([0, 1, 2, 255] * 10, dtype=np.uint8).view(np.bool_)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    assert pa.array(sparrow_array).to_pylist() == [False, True, True, True] * 10
+
+
 def test_to_numpy_copy_true_has_different_buffer():
     """to_numpy(copy=True) allocates a fresh buffer unrelated to the source."""
     source = np.array([1, 2, 3], dtype=np.int32)
@@ -212,6 +236,113 @@ def test_from_arrow_to_numpy_is_zero_copy_readonly_view():
     assert copied.__array_interface__["data"][0] != exported.__array_interface__["data"][0]
 
 
+def test_from_arrow_to_numpy_view_keeps_array_alive():
+    """The zero-copy view stays valid after the SparrowArray is dropped."""
+    import gc
+
+    sparrow_array = SparrowArray.from_arrow(pa.array([1.5, 2.5, 3.5], type=pa.float64()))
+    exported = sparrow_array.to_numpy()
+    address = _data_pointer(exported)
+
+    del sparrow_array
+    gc.collect()
+
+    assert _data_pointer(exported) == address
+    assert exported.tolist() == [1.5, 2.5, 3.5]
+    with pytest.raises(ValueError):
+        exported[0] = 0.0
+
+
+def test_to_numpy_writable_copies_borrowed_buffers_once():
+    """writable=True copies Arrow-imported values once, then reuses the copy."""
+    arrow_array = pa.array([1, 2, 3], type=pa.int64())
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    writable = sparrow_array.to_numpy(writable=True)
+    assert writable.flags.writeable
+    assert _data_pointer(writable) != arrow_array.buffers()[1].address
+    writable[0] = 10
+    assert arrow_array.to_pylist() == [1, 2, 3]
+
+    address = _data_pointer(writable)
+    del writable
+    again = sparrow_array.to_numpy(writable=True)
+    assert _data_pointer(again) == address
+    assert again.tolist() == [10, 2, 3]
+    assert pa.array(sparrow_array).to_pylist() == [10, 2, 3]
+
+
+def test_to_numpy_writable_is_zero_copy_for_owned_buffers():
+    """Values gathered by from_ndarray are owned, so no copy is made."""
+    source = np.arange(10, dtype=np.float64)[::2]
+    sparrow_array = SparrowArray.from_ndarray(source)
+    address = _data_pointer(sparrow_array.to_numpy())
+
+    writable = sparrow_array.to_numpy(writable=True)
+
+    assert writable.flags.writeable
+    assert _data_pointer(writable) == address
+    writable *= 2
+    assert sparrow_array.to_numpy().tolist() == [0.0, 4.0, 8.0, 12.0, 16.0]
+    assert source.tolist() == [0.0, 2.0, 4.0, 6.0, 8.0]
+
+
+def test_to_numpy_writable_does_not_change_live_views():
+    """A live read-only view shares the buffers, so writable=True copies them."""
+    sparrow_array = SparrowArray.from_ndarray(np.arange(6, dtype=np.int32)[::2])
+    view = sparrow_array.to_numpy()
+
+    writable = sparrow_array.to_numpy(writable=True)
+    writable[:] = -1
+
+    assert not np.shares_memory(view, writable)
+    assert view.tolist() == [0, 2, 4]
+    assert sparrow_array.to_numpy().tolist() == [-1, -1, -1]
+
+
+def test_to_numpy_writable_calls_share_a_live_writable_view():
+    """A second writable=True call returns the buffers of the live one."""
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int64()))
+
+    first = sparrow_array.to_numpy(writable=True)
+    second = sparrow_array.to_numpy(writable=True)
+    first[0] = 10
+
+    assert np.shares_memory(first, second)
+    assert second.tolist() == [10, 2, 3]
+    assert sparrow_array.to_numpy().tolist() == [10, 2, 3]
+
+
+def test_exports_copy_while_a_writable_view_is_alive():
+    """Arrow and DLPack exports get a snapshot, not the writable buffers."""
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int64()))
+    writable = sparrow_array.to_numpy(writable=True)
+    writable[0] = 10
+
+    exported = pa.array(sparrow_array)
+    tensor = np.from_dlpack(sparrow_array)
+    writable[1] = 20
+
+    assert exported.buffers()[1].address != _data_pointer(writable)
+    assert exported.to_pylist() == [10, 2, 3]
+    assert not np.shares_memory(tensor, writable)
+    assert tensor.tolist() == [10, 2, 3]
+    with pytest.raises(BufferError):
+        sparrow_array.__dlpack__(max_version=(1, 0), copy=False)
+
+
+def test_to_numpy_writable_with_ndarray_sources():
+    """A writable source is handed back; a read-only one is copied."""
+    source = np.array([1, 2, 3], dtype=np.int32)
+    assert SparrowArray.from_ndarray(source).to_numpy(writable=True) is source
+
+    readonly = np.array([1, 2, 3], dtype=np.int32)
+    readonly.flags.writeable = False
+    writable = SparrowArray.from_ndarray(readonly).to_numpy(writable=True)
+    assert writable.flags.writeable
+    assert not np.shares_memory(writable, readonly)
+
+
 def test_readonly_source_still_returns_same_object():
     """Even a readonly source ndarray is returned as-is by to_numpy()."""
     source = np.array([1, 2, 3], dtype=np.float64)
@@ -369,20 +500,343 @@ def test_ndarray_view_and_copy_have_different_buffers():
     assert _data_pointer(view) != _data_pointer(copied)
 
 
-def test_from_ndarray_rejects_multidimensional_arrays():
-    source = np.arange(6, dtype=np.int32).reshape(2, 3)
+def test_from_ndarray_align_copies_misaligned_data():
+    """align=True copies the data only when it is not 64-byte aligned."""
+    backing = np.arange(32, dtype=np.int32)
+    start = next(i for i in range(16) if (_data_pointer(backing) + 4 * i) % 64 != 0)
+    source = backing[start:start + 8]
 
-    with pytest.raises(ValueError, match="1D ndarrays"):
-        SparrowArray.from_ndarray(source)
+    sparrow_array = SparrowArray.from_ndarray(source, align=True)
+    exported = sparrow_array.to_numpy()
+
+    assert exported.tolist() == source.tolist()
+    assert _data_pointer(exported) % 64 == 0
+    assert not np.shares_memory(exported, source)
 
 
-def test_from_ndarray_rejects_non_contiguous_arrays():
-    source = np.arange(8, dtype=np.int32)[::2]
+def test_from_ndarray_rejects_arrays_with_more_than_two_dimensions():
+    source = np.arange(24, dtype=np.int32).reshape(2, 3, 4)
 
-    with pytest.raises(ValueError, match="contiguous 1D ndarray"):
+    with pytest.raises(ValueError, match="1D and 2D ndarrays"):
         SparrowArray.from_ndarray(source)
 
 
+def test_from_ndarray_imports_matrices_as_fixed_size_lists():
+    """A C-contiguous (N, K) ndarray is shared as N lists of K values."""
+    source = np.arange(12, dtype=np.float32).reshape(4, 3)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.type == pa.list_(pa.float32(), 3)
+    assert result.to_pylist() == source.tolist()
+    assert result.values.buffers()[1].address == _data_pointer(source)
+
+    exported = sparrow_array.to_numpy()
+    assert exported.shape == (4, 3)
+    assert np.shares_memory(exported, source)
+
+
+def test_from_ndarray_copies_non_c_contiguous_matrices():
+    source = np.asfortranarray(np.arange(12, dtype=np.int64).reshape(4, 3))
+
+    result = pa.array(SparrowArray.from_ndarray(source))
+
+    assert result.type == pa.list_(pa.int64(), 3)
+    assert result.to_pylist() == source.tolist()
+
+
+def test_from_ndarray_imports_bool_matrices():
+    source = np.array([[True, False], [False, False], [True, True]])
+
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    assert pa.array(sparrow_array).to_pylist() == source.tolist()
+    assert sparrow_array.to_numpy().tolist() == source.tolist()
+
+
+def test_from_ndarray_rejects_matrices_without_columns():
+    with pytest.raises(ValueError, match="at least one column"):
+        SparrowArray.from_ndarray(np.empty((3, 0), dtype=np.float64))
+
+
+def test_float16_import_is_zero_copy():
+    source = np.array([0.5, -2.0, 65504.0], dtype=np.float16)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.type == pa.float16()
+    assert result.buffers()[1].address == _data_pointer(source)
+
+
+def test_float16_export_from_arrow_is_a_view():
+    pa_array = pa.array(np.array([1.0, 2.5, -0.25], dtype=np.float16))
+    sparrow_array = SparrowArray.from_arrow(pa_array)
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.dtype == np.float16
+    assert exported.tolist() == [1.0, 2.5, -0.25]
+    assert _data_pointer(exported) == pa_array.buffers()[1].address
+
+
+@pytest.mark.parametrize("dtype", [np.float16, np.float32, np.float64])
+def test_nullable_float_export_uses_nan_sentinels(dtype):
+    """Nulls of nullable float arrays, sliced or not, become NaN in a copy."""
+    values = [float(i) if i % 7 != 3 else None for i in range(200)]
+    pa_array = pa.array(values, type=pa.from_numpy_dtype(dtype)).slice(5, 150)
+    sparrow_array = SparrowArray.from_arrow(pa_array)
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.dtype == dtype
+    expected = np.array([np.nan if v is None else v for v in values[5:155]], dtype=dtype)
+    np.testing.assert_array_equal(exported, expected)
+
+
+def test_fixed_size_list_export_is_a_matrix_view():
+    """Arrow fixed-size lists, including sliced ones, export as (N, K) views."""
+    values = pa.array(np.arange(20, dtype=np.int32))
+    lists = pa.FixedSizeListArray.from_arrays(values, 4).slice(1, 3)
+    sparrow_array = SparrowArray.from_arrow(lists)
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.shape == (3, 4)
+    assert exported.tolist() == lists.to_pylist()
+    assert _data_pointer(exported) == values.buffers()[1].address + 4 * 4
+    assert sparrow_array.to_numpy(copy=True).tolist() == lists.to_pylist()
+
+
+def test_fixed_size_list_export_rejects_nulls():
+    lists = pa.array([[1, 2], None], type=pa.list_(pa.int32(), 2))
+    sparrow_array = SparrowArray.from_arrow(lists)
+
+    with pytest.raises(TypeError, match="fixed-size lists with nulls"):
+        sparrow_array.to_numpy()
+
+
+@pytest.mark.parametrize(
+    ("np_dtype", "arrow_type"),
+    [
+        ("datetime64[s]", pa.timestamp("s")),
+        ("datetime64[ms]", pa.timestamp("ms")),
+        ("datetime64[us]", pa.timestamp("us")),
+        ("datetime64[ns]", pa.timestamp("ns")),
+        ("timedelta64[s]", pa.duration("s")),
+        ("timedelta64[ms]", pa.duration("ms")),
+        ("timedelta64[us]", pa.duration("us")),
+        ("timedelta64[ns]", pa.duration("ns")),
+    ],
+)
+def test_temporal_import_is_zero_copy(np_dtype, arrow_type):
+    source = np.array([0, 1_700_000_000, -86_400], dtype=np.int64).view(np_dtype)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.type == arrow_type
+    assert result.null_count == 0
+    assert result.buffers()[1].address == _data_pointer(source)
+    assert result.cast(pa.int64()).to_pylist() == source.view(np.int64).tolist()
+    assert sparrow_array.to_numpy() is source
+
+
+def test_datetime64_nat_becomes_null():
+    """NaT values are flagged in a validity bitmap; the values stay shared."""
+    source = np.arange(100, dtype=np.int64).view("datetime64[ns]")
+    source[3::7] = np.datetime64("NaT")
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.null_count == len(source[3::7])
+    assert result.is_null().to_pylist() == np.isnat(source).tolist()
+    assert result.buffers()[1].address == _data_pointer(source)
+    assert np.isnat(sparrow_array.to_numpy()).tolist() == np.isnat(source).tolist()
+
+
+def test_strided_timedelta64_with_nat_is_gathered():
+    source = np.arange(10, dtype=np.int64).view("timedelta64[ms]")
+    source[[2, 6]] = np.timedelta64("NaT")
+    view = source[::-2]
+
+    result = pa.array(SparrowArray.from_ndarray(view))
+    assert result.type == pa.duration("ms")
+    assert result.to_pylist() == [None if np.isnat(v) else v.item() for v in view]
+
+
+def test_datetime64_days_import_as_date32():
+    source = np.array(["2024-02-29", "NaT", "1969-12-31"], dtype="datetime64[D]")
+
+    result = pa.array(SparrowArray.from_ndarray(source))
+
+    assert result.type == pa.date32()
+    assert result.to_pylist() == [datetime.date(2024, 2, 29), None, datetime.date(1969, 12, 31)]
+
+
+def test_datetime64_matrix_import_as_fixed_size_lists():
+    source = np.arange(6, dtype=np.int64).view("datetime64[s]").reshape(3, 2)
+
+    result = pa.array(SparrowArray.from_ndarray(source))
+
+    assert result.type == pa.list_(pa.timestamp("s"), 2)
+    assert result.values.buffers()[1].address == _data_pointer(source)
+
+
+def test_masked_array_import_builds_validity_bitmap():
+    """The mask of a MaskedArray becomes the validity bitmap; the data stays shared."""
+    data = np.arange(20, dtype=np.int32)
+    source = np.ma.MaskedArray(data, mask=data % 3 == 0)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.to_pylist() == source.tolist()
+    assert result.null_count == 7
+    assert result.buffers()[1].address == _data_pointer(data)
+
+    exported = sparrow_array.to_numpy(nulls="mask")
+    assert exported.mask.tolist() == source.mask.tolist()
+    assert np.shares_memory(exported, data)
+
+
+def test_masked_array_without_mask_has_no_validity_bitmap():
+    result = pa.array(SparrowArray.from_ndarray(np.ma.MaskedArray([1.0, 2.0])))
+
+    assert result.null_count == 0
+    assert result.buffers()[0] is None
+
+
+@pytest.mark.parametrize(
+    ("source", "mask", "expected"),
+    [
+        (np.array([1.5, 2.5, 3.5, 4.5]), [False, True, False, True], [1.5, None, 3.5, None]),
+        (np.arange(4, dtype=np.uint16), np.array([1, 0, 0, 0, 1, 0, 0, 0], dtype=bool)[::2], [None, 1, None, 3]),
+        (np.array([True, False, True]), [False, False, True], [True, False, None]),
+        (np.arange(6, dtype=np.int64)[::-2], [False, True, False], [5, None, 1]),
+    ],
+)
+def test_mask_argument_builds_validity_bitmap(source, mask, expected):
+    result = pa.array(SparrowArray.from_ndarray(source, mask=mask))
+
+    assert result.to_pylist() == expected
+    assert result.null_count == expected.count(None)
+
+
+@pytest.mark.parametrize("dtype", [np.float16, np.float32, np.float64])
+def test_nan_null_sentinel_import_is_zero_copy(dtype):
+    source = np.array([1.0, np.nan, 3.0, np.nan], dtype=dtype)
+    sparrow_array = SparrowArray.from_ndarray(source, null_sentinel=float("nan"))
+
+    result = pa.array(sparrow_array)
+    assert result.to_pylist() == [1.0, None, 3.0, None]
+    assert result.buffers()[1].address == _data_pointer(source)
+
+
+def test_integer_null_sentinel_import():
+    source = np.array([4, -1, 6, -1, -1], dtype=np.int16)
+
+    result = pa.array(SparrowArray.from_ndarray(source, null_sentinel=-1))
+
+    assert result.to_pylist() == [4, None, 6, None, None]
+
+
+def test_mask_combines_with_nat():
+    source = np.array([1, 2, 3], dtype=np.int64).view("datetime64[s]")
+    source[0] = np.datetime64("NaT")
+
+    result = pa.array(SparrowArray.from_ndarray(source, mask=[False, True, False]))
+
+    assert result.is_null().to_pylist() == [True, True, False]
+
+
+@pytest.mark.parametrize(
+    ("source", "kwargs", "match"),
+    [
+        (np.arange(3.0), {"mask": [True, False]}, "same shape"),
+        (np.ma.MaskedArray([1.0, 2.0], mask=[True, False]), {"mask": [True, False]}, "MaskedArray"),
+        (np.arange(3.0), {"mask": [True, False, False], "null_sentinel": 0.0}, "not both"),
+        (np.arange(6.0).reshape(3, 2), {"null_sentinel": 0.0}, "1D"),
+    ],
+)
+def test_from_ndarray_rejects_invalid_nulls(source, kwargs, match):
+    with pytest.raises(ValueError, match=match):
+        SparrowArray.from_ndarray(source, **kwargs)
+
+
+@pytest.mark.parametrize(
+    ("arrow_type", "np_dtype"),
+    [
+        (pa.timestamp("ms"), "datetime64[ms]"),
+        (pa.timestamp("ns", tz="UTC"), "datetime64[ns]"),
+        (pa.duration("us"), "timedelta64[us]"),
+        (pa.date64(), "datetime64[ms]"),
+    ],
+)
+def test_temporal_export_from_arrow_is_a_view(arrow_type, np_dtype):
+    values = np.array([0, 86_400_000, -86_400_000], dtype=np.int64)
+    pa_array = pa.Array.from_buffers(arrow_type, len(values), [None, pa.py_buffer(values)])
+
+    exported = SparrowArray.from_arrow(pa_array).to_numpy()
+
+    assert exported.dtype == np.dtype(np_dtype)
+    assert exported.view(np.int64).tolist() == values.tolist()
+    assert _data_pointer(exported) == _data_pointer(values)
+
+
+def test_nullable_temporal_export_uses_nat():
+    pa_array = pa.array([1, None, 3, None], type=pa.duration("s")).slice(1)
+
+    exported = SparrowArray.from_arrow(pa_array).to_numpy()
+
+    assert exported.dtype == np.dtype("timedelta64[s]")
+    assert np.isnat(exported).tolist() == [True, False, True]
+    assert exported[1] == np.timedelta64(3, "s")
+
+
+def test_date32_export_widens_to_datetime64_days():
+    pa_array = pa.array([datetime.date(2024, 1, 1), None], type=pa.date32())
+
+    exported = SparrowArray.from_arrow(pa_array).to_numpy()
+
+    assert exported.dtype == np.dtype("datetime64[D]")
+    assert exported.tolist() == [datetime.date(2024, 1, 1), None]
+
+
+@pytest.mark.parametrize(
+    "source",
+    [
+        np.arange(8, dtype=np.int32)[::2],
+        np.arange(8, dtype=np.int64)[::-1],
+        np.arange(40, dtype=np.float32).reshape(8, 5)[:, 3],
+        np.broadcast_to(np.array(7, dtype=np.uint16), (5,)),
+        np.array([True, False, False, True, True] * 5)[::-3],
+    ],
+)
+def test_from_ndarray_gathers_strided_arrays(source):
+    """Strided views (including negative and zero strides) are copied."""
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.to_pylist() == source.tolist()
+    assert result.buffers()[1].address % 64 == 0
+    assert not np.shares_memory(np.asarray(sparrow_array), source)
+
+
+def test_from_ndarray_gathers_large_strided_arrays():
+    """Large gathers are split across threads."""
+    source = np.arange(3_000_000, dtype=np.float64)[::-3]
+
+    result = np.asarray(SparrowArray.from_ndarray(source))
+
+    assert np.array_equal(result, source)
+
+
+def test_from_ndarray_keeps_contiguous_arrays_zero_copy():
+    source = np.arange(8, dtype=np.int32)[2:6]
+
+    result = np.asarray(SparrowArray.from_ndarray(source))
+
+    assert np.shares_memory(result, source)
+
+
 def test_from_ndarray_rejects_unsupported_dtypes():
     source = np.array([1 + 2j, 3 + 4j], dtype=np.complex64)
 
@@ -390,6 +844,66 @@ def test_from_ndarray_rejects_unsupported_dtypes():
         SparrowArray.from_ndarray(source)
 
 
+@pytest.mark.parametrize(
+    "dtype",
+    [np.byte, np.ubyte, np.short, np.intc, np.uintc, np.int_, np.uint, np.longlong, np.ulonglong, np.intp],
+)
+def test_from_ndarray_resolves_platform_dtypes_by_size(dtype):
+    """C type aliases map to the Arrow integer of the same width."""
+    source = np.array([1, 2, 3], dtype=dtype)
+
+    result = np.asarray(SparrowArray.from_ndarray(source))
+
+    assert result.dtype.itemsize == source.dtype.itemsize
+    assert result.dtype.kind == source.dtype.kind
+    assert result.tolist() == [1, 2, 3]
+
+
+@pytest.mark.parametrize("dtype", [">i2", ">u4", ">i8", ">f2", ">f4", ">f8", "<i4", "<f8"])
+def test_from_ndarray_swaps_non_native_byte_order(dtype):
+    """Big- and little-endian data alike import in native byte order."""
+    source = np.arange(100, dtype=dtype)
+
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    result = pa.array(sparrow_array)
+    assert result.to_pylist() == source.tolist()
+    assert result.buffers()[1].address % 64 == 0
+    assert sparrow_array.to_numpy().dtype == source.dtype.newbyteorder("=")
+
+
+def test_from_ndarray_swaps_strided_non_native_byte_order():
+    source = np.arange(40, dtype=">f8").reshape(8, 5)[::-1, 2]
+
+    result = pa.array(SparrowArray.from_ndarray(source))
+
+    assert result.to_pylist() == source.tolist()
+
+
+def test_from_ndarray_swaps_non_native_temporal_data():
+    source = np.array(["2024-01-01T00:00:01", "NaT"], dtype=">M8[s]")
+
+    result = pa.array(SparrowArray.from_ndarray(source))
+
+    assert result.type == pa.timestamp("s")
+    assert result.to_pylist() == [datetime.datetime(2024, 1, 1, 0, 0, 1), None]
+
+
+@pytest.mark.parametrize(
+    "source",
+    [
+        np.array(["2024-01-01T10"], dtype="datetime64[h]"),
+        np.array([10, 20], dtype="timedelta64[10s]"),
+        np.array([1, 2], dtype="timedelta64[D]"),
+        np.array([b"ab", b"cd"]),
+        np.array([1, "a"], dtype=object),
+    ],
+)
+def test_from_ndarray_rejects_dtypes_without_arrow_mapping(source):
+    with pytest.raises(TypeError, match="Unsupported ndarray dtype"):
+        SparrowArray.from_ndarray(source)
+
+
 def test_nullable_integer_export_is_rejected():
     sparrow_array = test_sparrow_helper.create_test_array()
 
@@ -404,13 +918,219 @@ def test_nullable_bool_export_is_rejected():
         sparrow_array.to_numpy()
 
 
+@pytest.mark.parametrize(
+    "arrow_dtype",
+    [pa.int8(), pa.uint16(), pa.int32(), pa.uint64(), pa.float64()],
+)
+def test_nullable_export_as_masked_array_is_zero_copy(arrow_dtype):
+    pa_array = pa.array([1, None, 3, None, 5, 6, 7, 8, 9, None], type=arrow_dtype).slice(1)
+    sparrow_array = SparrowArray.from_arrow(pa_array)
+
+    exported = sparrow_array.to_numpy(nulls="mask")
+
+    assert isinstance(exported, np.ma.MaskedArray)
+    assert exported.tolist() == pa_array.to_pylist()
+    assert exported.mask.tolist() == [value is None for value in pa_array.to_pylist()]
+    value_address = pa_array.buffers()[1].address + pa_array.offset * arrow_dtype.bit_width // 8
+    assert _data_pointer(exported.data) == value_address
+
+
+def test_nullable_bool_export_as_masked_array():
+    sparrow_array = test_sparrow_helper.create_nullable_bool_array()
+
+    exported = sparrow_array.to_numpy(nulls="mask")
+
+    assert exported.dtype == np.bool_
+    assert exported.mask.any()
+
+
+def test_bool_export_unpacks_sliced_bitmaps():
+    values = [(i * 7) % 3 == 0 for i in range(1000)]
+    pa_array = pa.array(values, type=pa.bool_()).slice(5, 990)
+    sparrow_array = SparrowArray.from_arrow(pa_array)
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.dtype == np.bool_
+    assert exported.tolist() == values[5:995]
+
+
+def test_non_nullable_export_as_masked_array_has_no_mask():
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int32()))
+
+    exported = sparrow_array.to_numpy(nulls="mask")
+
+    assert exported.mask is np.ma.nomask
+    assert exported.tolist() == [1, 2, 3]
+
+
+def test_nullable_export_with_sentinel():
+    pa_array = pa.array([1, None, 3], type=pa.int16())
+    sparrow_array = SparrowArray.from_arrow(pa_array)
+
+    exported = sparrow_array.to_numpy(nulls="sentinel", fill_value=-1)
+
+    assert exported.dtype == np.int16
+    assert exported.tolist() == [1, -1, 3]
+    assert pa_array.to_pylist() == [1, None, 3]
+
+
+def test_sentinel_export_requires_fill_value():
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, None], type=pa.int32()))
+
+    with pytest.raises(ValueError, match="fill_value"):
+        sparrow_array.to_numpy(nulls="sentinel")
+    with pytest.raises(ValueError, match="nulls"):
+        sparrow_array.to_numpy(nulls="drop")
+
+
 def test_non_primitive_export_is_rejected():
+    sparrow_array = SparrowArray.from_arrow(pa.array([[1, 2], [3]]))
+
+    with pytest.raises(TypeError, match="primitive, string and binary 1D Sparrow arrays"):
+        sparrow_array.to_numpy()
+
+
+# =============================================================================
+# String and binary export
+# =============================================================================
+
+_HAS_STRING_DTYPE = hasattr(np, "dtypes") and hasattr(np.dtypes, "StringDType")
+
+
+def test_string_export():
+    """utf8 arrays export as StringDType on NumPy 2 and as object arrays before."""
     sparrow_array = test_sparrow_helper.create_string_array()
 
-    with pytest.raises(TypeError, match="primitive 1D Sparrow arrays"):
+    exported = sparrow_array.to_numpy()
+
+    if _HAS_STRING_DTYPE:
+        assert isinstance(exported.dtype, np.dtypes.StringDType)
+    else:
+        assert exported.dtype == object
+    assert exported.tolist() == ["alpha", "beta", "gamma"]
+    assert not exported.flags.writeable
+    assert sparrow_array.to_numpy(copy=True).flags.writeable
+
+
+@pytest.mark.parametrize("arrow_type", [pa.string(), pa.large_string()])
+def test_nullable_string_export(arrow_type):
+    """Nulls become None, sliced arrays start at their offset."""
+    arrow_array = pa.array(["x", None, "", "é", None, "long enough string"], type=arrow_type)
+    sparrow_array = SparrowArray.from_arrow(arrow_array.slice(1))
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.tolist() == [None, "", "é", None, "long enough string"]
+    masked = sparrow_array.to_numpy(nulls="mask")
+    assert masked.mask.tolist() == [True, False, False, True, False]
+    filled = sparrow_array.to_numpy(nulls="sentinel", fill_value="?")
+    assert filled.tolist() == ["?", "", "é", "?", "long enough string"]
+
+
+@pytest.mark.parametrize("arrow_type", [pa.binary(), pa.large_binary()])
+def test_binary_export(arrow_type):
+    """Binary arrays export as object arrays of bytes."""
+    sparrow_array = SparrowArray.from_arrow(pa.array([b"\x00\xff", None, b"abc"], type=arrow_type))
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.dtype == object
+    assert exported.tolist() == [b"\x00\xff", None, b"abc"]
+
+
+def test_low_cardinality_string_export_reuses_objects():
+    """Repeated values of a low-cardinality column share one str object."""
+    values = ["red", "green", "blue"] * 1000
+    sparrow_array = SparrowArray.from_arrow(pa.array(values))
+
+    exported = sparrow_array.to_numpy()
+
+    assert exported.tolist() == values
+    if not _HAS_STRING_DTYPE:
+        assert exported[0] is exported[3]
+
+
+def test_high_cardinality_string_export():
+    """Mostly distinct values are exported correctly once deduplication stops."""
+    values = [f"value-{i}" for i in range(5000)] + ["value-1"]
+    sparrow_array = SparrowArray.from_arrow(pa.array(values, type=pa.large_string()))
+
+    assert sparrow_array.to_numpy().tolist() == values
+
+
+def test_invalid_utf8_export_raises():
+    """Invalid UTF-8 in a utf8 array raises instead of producing garbage."""
+    binary = pa.array([b"ok", b"\xff\xfe"], type=pa.binary())
+    sparrow_array = SparrowArray.from_arrow(binary.view(pa.string()), validate="trusted")
+
+    with pytest.raises(UnicodeDecodeError):
         sparrow_array.to_numpy()
 
 
+# =============================================================================
+# Dictionary-encoded export
+# =============================================================================
+
+
+def test_dictionary_export_as_codes_and_categories():
+    """dictionary='codes' shares the index buffer and exports the dictionary apart."""
+    arrow_array = pa.array(["low", "high", "low", "mid", "low"]).dictionary_encode()
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    codes, categories = sparrow_array.to_numpy(dictionary="codes")
+
+    assert codes.dtype == np.int32
+    assert codes.tolist() == arrow_array.indices.to_pylist()
+    assert _data_pointer(codes) == arrow_array.indices.buffers()[1].address
+    assert categories.tolist() == ["low", "high", "mid"]
+    assert categories[codes].tolist() == arrow_array.to_pylist()
+
+
+def test_dictionary_export_with_numeric_dictionary_and_nulls():
+    """Nullable codes follow the nulls argument; numeric dictionaries are views."""
+    indices = pa.array([1, None, 0, 1], type=pa.int8())
+    dictionary = pa.array([2.5, 7.5])
+    arrow_array = pa.DictionaryArray.from_arrays(indices, dictionary)
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    with pytest.raises(TypeError, match="nullable dictionary codes"):
+        sparrow_array.to_numpy(dictionary="codes")
+    codes, categories = sparrow_array.to_numpy(dictionary="codes", nulls="sentinel", fill_value=-1)
+    assert codes.tolist() == [1, -1, 0, 1]
+    assert _data_pointer(categories) == dictionary.buffers()[1].address
+    masked, _ = sparrow_array.to_numpy(dictionary="codes", nulls="mask")
+    assert masked.mask.tolist() == [False, True, False, False]
+
+
+def test_dictionary_export_mode_must_match_the_array():
+    """Dictionary arrays need dictionary='codes', which plain arrays reject."""
+    encoded = SparrowArray.from_arrow(pa.array(["a", "b"]).dictionary_encode())
+    plain = SparrowArray.from_arrow(pa.array([1, 2]))
+
+    with pytest.raises(TypeError, match="dictionary='codes'"):
+        encoded.to_numpy()
+    with pytest.raises(TypeError, match="dictionary-encoded"):
+        plain.to_numpy(dictionary="codes")
+    with pytest.raises(ValueError, match="dictionary"):
+        encoded.to_numpy(dictionary="values")
+
+
+def test_to_categorical():
+    """to_categorical builds a pandas.Categorical from the codes, -1 for nulls."""
+    pd = pytest.importorskip("pandas")
+    arrow_array = pa.array(["b", None, "a", "b"]).dictionary_encode()
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    categorical = sparrow_array.to_categorical()
+
+    assert isinstance(categorical, pd.Categorical)
+    assert categorical.codes.tolist() == [0, -1, 1, 0]
+    assert list(categorical.categories) == ["b", "a"]
+    assert not categorical.ordered
+    assert list(categorical.astype(object)) == ["b", np.nan, "a", "b"]
+
+
 def test_from_arrow_numeric_export_is_readonly():
     sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int32()))
 
@@ -429,6 +1149,158 @@ def test_array_protocol_rejects_dtype_coercion():
         sparrow_array.__array__(dtype=np.dtype(np.float64))
 
 
+# =============================================================================
+# DLPack export and import
+# =============================================================================
+
+
+def test_dlpack_device_is_cpu():
+    """SparrowArray reports the CPU device to DLPack consumers."""
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3]))
+
+    assert sparrow_array.__dlpack_device__() == (1, 0)
+
+
+def test_dlpack_export_shares_arrow_buffer():
+    """numpy.from_dlpack gets a read-only view of the Arrow buffer."""
+    arrow_array = pa.array([1.5, 2.5, 3.5, 4.5]).slice(1)
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    exported = np.from_dlpack(sparrow_array)
+
+    assert exported.tolist() == [2.5, 3.5, 4.5]
+    assert _data_pointer(exported) == arrow_array.buffers()[1].address + 8
+    assert not exported.flags.writeable
+
+
+def test_dlpack_export_of_ndarray_backed_array_is_writable():
+    """A writable NumPy source stays writable through DLPack."""
+    source = np.arange(6, dtype=np.int32)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    exported = np.from_dlpack(sparrow_array)
+    exported[0] = 42
+
+    assert _data_pointer(exported) == _data_pointer(source)
+    assert source[0] == 42
+
+
+def test_dlpack_export_fixed_size_lists_as_2d():
+    """Fixed-size lists export as a (length, list_size) tensor over the same memory."""
+    source = np.arange(12, dtype=np.float32).reshape(4, 3)
+    sparrow_array = SparrowArray.from_ndarray(source)
+
+    exported = np.from_dlpack(sparrow_array)
+
+    assert exported.shape == (4, 3)
+    assert np.shares_memory(exported, source)
+    np.testing.assert_array_equal(exported, source)
+
+
+def test_dlpack_export_copies():
+    """copy=True and bool arrays give independent tensors; copy=False refuses bools."""
+    sparrow_array = SparrowArray.from_arrow(pa.array([1, 2, 3], type=pa.int16()))
+    bools = SparrowArray.from_arrow(pa.array([True, False, True]))
+
+    copied = np.from_dlpack(sparrow_array, copy=True)
+    copied[0] = 7
+
+    assert sparrow_array.to_numpy().tolist() == [1, 2, 3]
+    assert np.from_dlpack(bools).tolist() == [True, False, True]
+    with pytest.raises(BufferError):
+        np.from_dlpack(bools, copy=False)
+
+
+def test_dlpack_export_rejects_nulls_and_non_numeric_arrays():
+    """Nulls, strings and dictionaries cannot be described by a DLPack tensor."""
+    for arrow_array in (
+        pa.array([1, None, 3]),
+        pa.array(["a", "b"]),
+        pa.array(["a", "b"]).dictionary_encode(),
+    ):
+        with pytest.raises(TypeError):
+            SparrowArray.from_arrow(arrow_array).__dlpack__()
+
+
+def test_dlpack_legacy_export_does_not_write_through_to_arrow():
+    """Legacy capsules cannot be flagged read-only, so they hold a private copy."""
+    arrow_array = pa.array([1, 2, 3], type=pa.int64())
+    sparrow_array = SparrowArray.from_arrow(arrow_array)
+
+    imported = SparrowArray.from_dlpack(sparrow_array.__dlpack__())
+
+    assert imported.to_numpy().tolist() == [1, 2, 3]
+    assert _data_pointer(imported.to_numpy()) != arrow_array.buffers()[1].address
+    # The array itself keeps sharing the Arrow buffers
+    assert _data_pointer(sparrow_array.to_numpy()) == arrow_array.buffers()[1].address
+    with pytest.raises(BufferError):
+        sparrow_array.__dlpack__(copy=False)
+
+
+@pytest.mark.parametrize("dtype", [np.int8, np.uint16, np.int32, np.uint64, np.float16, np.float32, np.float64])
+def test_dlpack_import_shares_memory(dtype):
+    """Contiguous tensors are imported zero-copy and kept alive by the array."""
+    import gc
+
+    source = np.arange(8, dtype=dtype)
+    address = _data_pointer(source)
+    sparrow_array = SparrowArray.from_dlpack(source)
+    del source
+    gc.collect()
+
+    exported = sparrow_array.to_numpy()
+    assert exported.dtype == dtype
+    assert exported.tolist() == list(range(8))
+    assert _data_pointer(exported) == address
+
+
+def test_dlpack_import_strided_2d_and_bool_tensors():
+    """Strided tensors are gathered, 2D ones become fixed-size lists, bools are packed."""
+    source = np.arange(20, dtype=np.int64)
+
+    strided = SparrowArray.from_dlpack(source[::-3])
+    matrix = SparrowArray.from_dlpack(source.reshape(4, 5)[:, 1:4])
+    bools = SparrowArray.from_dlpack(np.array([True, False, True]))
+
+    assert strided.to_numpy().tolist() == source[::-3].tolist()
+    assert pa.array(matrix).type == pa.list_(pa.int64(), 3)
+    np.testing.assert_array_equal(matrix.to_numpy(), source.reshape(4, 5)[:, 1:4])
+    assert pa.array(bools).to_pylist() == [True, False, True]
+
+
+def test_dlpack_import_accepts_capsules_and_sparrow_arrays():
+    """Legacy capsules and SparrowArray producers round-trip without copy."""
+    source = np.arange(5, dtype=np.uint32)
+
+    from_capsule = SparrowArray.from_dlpack(source.__dlpack__())
+    roundtrip = SparrowArray.from_dlpack(SparrowArray.from_ndarray(source))
+
+    assert _data_pointer(from_capsule.to_numpy()) == _data_pointer(source)
+    assert _data_pointer(roundtrip.to_numpy()) == _data_pointer(source)
+
+
+def test_dlpack_import_rejects_unsupported_tensors():
+    """Complex, 0-D and 3-D tensors are rejected."""
+    with pytest.raises(TypeError, match="Unsupported DLPack dtype"):
+        SparrowArray.from_dlpack(np.zeros(3, dtype=np.complex64))
+    with pytest.raises(ValueError, match="1D and 2D"):
+        SparrowArray.from_dlpack(np.zeros((2, 2, 2)))
+    with pytest.raises(TypeError):
+        SparrowArray.from_dlpack([1, 2, 3])
+
+
+def test_dlpack_torch_roundtrip():
+    """PyTorch CPU tensors are exchanged zero-copy both ways."""
+    torch = pytest.importorskip("torch")
+    tensor = torch.arange(6, dtype=torch.float32)
+
+    sparrow_array = SparrowArray.from_dlpack(tensor)
+    back = torch.from_dlpack(sparrow_array)
+
+    assert back.tolist() == [0.0, 1.0, 2.0, 3.0, 4.0, 5.0]
+    assert back.data_ptr() == tensor.data_ptr()
+
+
 # =============================================================================
 # NumPy operations on exported arrays
 # =============================================================================
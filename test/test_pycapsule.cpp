@@ -1,5 +1,10 @@
+#include <memory>
 #include <optional>
+#include <string_view>
+#include <sparrow-rockfinch/arrow_device_interface.hpp>
 #include <sparrow-rockfinch/pycapsule.hpp>
+#include <sparrow-rockfinch/detail/lazy_arrow_array.hpp>
+#include <sparrow-rockfinch/detail/shared_arrow_schema.hpp>
 
 #include <sparrow/array.hpp>
 #include <sparrow/primitive_array.hpp>
@@ -147,6 +152,119 @@ namespace sparrow::rockfinch
             }
         }
 
+        TEST_CASE("export_shared_array_to_capsules")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("shares_buffers_with_source")
+            {
+                auto shared = std::make_shared<const sparrow::array>(make_test_array());
+                const ArrowArray* source = sparrow::get_arrow_array(*shared);
+
+                auto [schema_capsule, array_capsule] = export_shared_array_to_capsules(shared);
+
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                REQUIRE_NE(schema_capsule, nullptr);
+                REQUIRE_NE(array_capsule, nullptr);
+
+                ArrowArray* array = static_cast<ArrowArray*>(
+                    PyCapsule_GetPointer(array_capsule, "arrow_array")
+                );
+                REQUIRE_NE(array, nullptr);
+                CHECK_EQ(array->length, 5);
+                CHECK_EQ(array->n_buffers, source->n_buffers);
+                CHECK_EQ(array->buffers[0], source->buffers[0]);
+                CHECK_EQ(array->buffers[1], source->buffers[1]);
+                CHECK_EQ(shared.use_count(), 2);
+            }
+
+            SUBCASE("exported_array_keeps_source_alive")
+            {
+                auto shared = std::make_shared<const sparrow::array>(make_test_array());
+                auto [schema_capsule, array_capsule] = export_shared_array_to_capsules(shared);
+
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                std::weak_ptr<const sparrow::array> weak = shared;
+                shared.reset();
+                CHECK_FALSE(weak.expired());
+
+                auto imported_arr = import_array_from_capsules(schema_capsule, array_capsule);
+                CHECK_EQ(imported_arr.size(), 5);
+                CHECK_FALSE(weak.expired());
+            }
+
+            SUBCASE("release_drops_reference")
+            {
+                auto shared = std::make_shared<const sparrow::array>(make_test_array());
+                {
+                    auto [schema_capsule, array_capsule] = export_shared_array_to_capsules(shared);
+                    PyObjectGuard schema_guard(schema_capsule);
+                    PyObjectGuard array_guard(array_capsule);
+                    CHECK_EQ(shared.use_count(), 2);
+                }
+                CHECK_EQ(shared.use_count(), 1);
+            }
+        }
+
+        TEST_CASE("export_shared_schema_to_capsule")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("exports_share_cached_strings")
+            {
+                auto arr = make_test_array();
+                auto cached = detail::shared_arrow_schema::make(*sparrow::get_arrow_schema(arr));
+
+                PyObjectGuard first(export_shared_schema_to_capsule(*cached));
+                PyObjectGuard second(export_shared_schema_to_capsule(*cached));
+
+                REQUIRE_NE(first.get(), nullptr);
+                REQUIRE_NE(second.get(), nullptr);
+                CHECK_EQ(std::string(PyCapsule_GetName(first.get())), "arrow_schema");
+
+                auto* first_schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(first.get(), "arrow_schema"));
+                auto* second_schema = static_cast<ArrowSchema*>(
+                    PyCapsule_GetPointer(second.get(), "arrow_schema")
+                );
+                REQUIRE_NE(first_schema, nullptr);
+                REQUIRE_NE(second_schema, nullptr);
+                CHECK_EQ(std::string(first_schema->format), "i");
+                CHECK_EQ(first_schema->format, second_schema->format);
+                CHECK_EQ(first_schema->format, cached->schema().format);
+            }
+
+            SUBCASE("exports_outlive_cache_handle")
+            {
+                auto arr = make_test_array();
+                auto cached = detail::shared_arrow_schema::make(*sparrow::get_arrow_schema(arr));
+                PyObjectGuard capsule(export_shared_schema_to_capsule(*cached));
+                cached.reset();
+
+                auto* schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(capsule.get(), "arrow_schema"));
+                REQUIRE_NE(schema, nullptr);
+                CHECK_EQ(std::string(schema->format), "i");
+                CHECK_NE(schema->release, nullptr);
+            }
+
+            SUBCASE("exported_schema_can_be_imported")
+            {
+                auto shared = std::make_shared<const sparrow::array>(make_test_array());
+                auto cached = detail::shared_arrow_schema::make(*sparrow::get_arrow_schema(*shared));
+
+                auto [schema_capsule, array_capsule] = export_shared_array_to_capsules(shared, *cached);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                auto imported_arr = import_array_from_capsules(schema_capsule, array_capsule);
+                CHECK_EQ(imported_arr.size(), 5);
+                CHECK_EQ(imported_arr.data_type(), sparrow::data_type::INT32);
+            }
+        }
+
         TEST_CASE("import_array_from_capsules")
         {
             PythonInitializer py_init;
@@ -210,6 +328,319 @@ namespace sparrow::rockfinch
             }
         }
 
+        TEST_CASE("import_arrays_from_capsules")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("imports_all_pairs")
+            {
+                std::vector<PyObjectGuard> guards;
+                std::vector<std::pair<PyObject*, PyObject*>> pairs;
+                for (int i = 0; i < 3; ++i)
+                {
+                    auto arr = make_test_array();
+                    auto capsules = export_array_to_capsules(arr);
+                    guards.emplace_back(capsules.first);
+                    guards.emplace_back(capsules.second);
+                    pairs.push_back(capsules);
+                }
+
+                auto arrays = import_arrays_from_capsules(pairs);
+
+                REQUIRE(arrays.has_value());
+                REQUIRE_EQ(arrays->size(), 3);
+                for (const auto& arr : *arrays)
+                {
+                    CHECK_EQ(arr.size(), 5);
+                }
+                for (const auto& [schema_capsule, array_capsule] : pairs)
+                {
+                    auto* array = static_cast<ArrowArray*>(PyCapsule_GetPointer(array_capsule, "arrow_array"));
+                    CHECK_EQ(array->release, nullptr);
+                }
+            }
+
+            SUBCASE("reuses_shared_schema_capsule")
+            {
+                auto first = make_test_array();
+                auto second = make_test_array();
+                auto [schema_capsule, first_array] = export_array_to_capsules(first);
+                auto [unused_schema, second_array] = export_array_to_capsules(second);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard unused_guard(unused_schema);
+                PyObjectGuard first_guard(first_array);
+                PyObjectGuard second_guard(second_array);
+
+                std::vector<std::pair<PyObject*, PyObject*>> pairs = {
+                    {schema_capsule, first_array},
+                    {schema_capsule, second_array}
+                };
+                auto arrays = import_arrays_from_capsules(pairs);
+
+                REQUIRE(arrays.has_value());
+                REQUIRE_EQ(arrays->size(), 2);
+                CHECK_EQ((*arrays)[0].data_type(), sparrow::data_type::INT32);
+                CHECK_EQ((*arrays)[1].data_type(), sparrow::data_type::INT32);
+                CHECK_EQ((*arrays)[1].size(), 5);
+            }
+
+            SUBCASE("shares_equal_schemas_of_distinct_capsules")
+            {
+                std::vector<PyObjectGuard> guards;
+                std::vector<std::pair<PyObject*, PyObject*>> pairs;
+                for (int i = 0; i < 2; ++i)
+                {
+                    auto arr = make_test_array();
+                    auto capsules = export_array_to_capsules(arr);
+                    guards.emplace_back(capsules.first);
+                    guards.emplace_back(capsules.second);
+                    pairs.push_back(capsules);
+                }
+
+                auto arrays = import_arrays_from_capsules(pairs);
+
+                REQUIRE(arrays.has_value());
+                REQUIRE_EQ(arrays->size(), 2);
+                // Both schemas are exports of the same shared copy
+                CHECK_EQ(
+                    sparrow::get_arrow_schema((*arrays)[0])->format,
+                    sparrow::get_arrow_schema((*arrays)[1])->format
+                );
+                for (const auto& [schema_capsule, array_capsule] : pairs)
+                {
+                    auto* schema = static_cast<ArrowSchema*>(PyCapsule_GetPointer(schema_capsule, "arrow_schema"));
+                    CHECK_EQ(schema->release, nullptr);
+                }
+            }
+
+            SUBCASE("empty_batch_is_not_an_error")
+            {
+                auto arrays = import_arrays_from_capsules({});
+
+                REQUIRE(arrays.has_value());
+                CHECK(arrays->empty());
+                CHECK(PyErr_Occurred() == nullptr);
+            }
+
+            SUBCASE("invalid_batch_consumes_nothing")
+            {
+                auto arr = make_test_array();
+                auto [schema_capsule, array_capsule] = export_array_to_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                std::vector<std::pair<PyObject*, PyObject*>> pairs = {
+                    {schema_capsule, array_capsule},
+                    {schema_capsule, array_capsule}
+                };
+                auto arrays = import_arrays_from_capsules(pairs);
+
+                CHECK_FALSE(arrays.has_value());
+                CHECK(PyErr_Occurred() != nullptr);
+                PyErr_Clear();
+
+                auto* array = static_cast<ArrowArray*>(PyCapsule_GetPointer(array_capsule, "arrow_array"));
+                CHECK_NE(array->release, nullptr);
+            }
+        }
+
+        TEST_CASE("capsule_pools")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("released_structures_are_reused")
+            {
+                {
+                    auto arr = make_test_array();
+                    auto [schema_capsule, array_capsule] = export_array_to_capsules(arr);
+                    PyObjectGuard schema_guard(schema_capsule);
+                    PyObjectGuard array_guard(array_capsule);
+                }
+
+                reset_capsule_pools_stats();
+                const auto before = get_capsule_pools_stats();
+                CHECK_GT(before.schema.cached, 0);
+                CHECK_GT(before.array.cached, 0);
+
+                auto arr = make_test_array();
+                auto [schema_capsule, array_capsule] = export_array_to_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                const auto after = get_capsule_pools_stats();
+                CHECK_EQ(after.schema.hits, 1);
+                CHECK_EQ(after.array.hits, 1);
+                CHECK_EQ(after.schema.misses, 0);
+                CHECK_EQ(after.array.misses, 0);
+            }
+
+            SUBCASE("stream_structures_are_pooled")
+            {
+                {
+                    std::vector<sparrow::array> arrays;
+                    arrays.push_back(make_test_array());
+                    sparrow::arrow_array_stream_proxy proxy;
+                    proxy.push(std::move(arrays));
+                    PyObjectGuard capsule_guard(export_stream_proxy_to_capsule(proxy));
+                }
+
+                reset_capsule_pools_stats();
+                std::vector<sparrow::array> arrays;
+                arrays.push_back(make_test_array());
+                sparrow::arrow_array_stream_proxy proxy;
+                proxy.push(std::move(arrays));
+                PyObjectGuard capsule_guard(export_stream_proxy_to_capsule(proxy));
+
+                const auto stats = get_capsule_pools_stats();
+                CHECK_EQ(stats.stream.hits, 1);
+                CHECK_EQ(stats.stream.misses, 0);
+            }
+        }
+
+        TEST_CASE("device_capsules")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("array_round_trip")
+            {
+                auto arr = make_test_array();
+                auto [schema_capsule, device_array_capsule] = export_array_to_device_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard device_array_guard(device_array_capsule);
+
+                REQUIRE_NE(device_array_capsule, nullptr);
+                auto* device_array = static_cast<ArrowDeviceArray*>(
+                    PyCapsule_GetPointer(device_array_capsule, "arrow_device_array")
+                );
+                REQUIRE_NE(device_array, nullptr);
+                CHECK_EQ(device_array->device_type, ARROW_DEVICE_CPU);
+                CHECK_EQ(device_array->sync_event, nullptr);
+
+                auto imported = import_array_from_device_capsules(schema_capsule, device_array_capsule);
+                CHECK_EQ(imported.size(), 5);
+                CHECK_EQ(device_array->array.release, nullptr);
+            }
+
+            SUBCASE("shared_array_export")
+            {
+                auto arr = std::make_shared<const sparrow::array>(make_test_array());
+                const auto schema = detail::shared_arrow_schema::make(*sparrow::get_arrow_schema(*arr));
+                auto [schema_capsule, device_array_capsule] = export_shared_array_to_device_capsules(arr, *schema);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard device_array_guard(device_array_capsule);
+
+                auto* device_array = static_cast<ArrowDeviceArray*>(
+                    PyCapsule_GetPointer(device_array_capsule, "arrow_device_array")
+                );
+                REQUIRE_NE(device_array, nullptr);
+                CHECK_EQ(device_array->device_type, ARROW_DEVICE_CPU);
+                CHECK_EQ(device_array->array.buffers[1], sparrow::get_arrow_array(*arr)->buffers[1]);
+            }
+
+            SUBCASE("non_cpu_array_is_rejected")
+            {
+                auto arr = make_test_array();
+                auto [schema_capsule, device_array_capsule] = export_array_to_device_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard device_array_guard(device_array_capsule);
+
+                auto* device_array = static_cast<ArrowDeviceArray*>(
+                    PyCapsule_GetPointer(device_array_capsule, "arrow_device_array")
+                );
+                device_array->device_type = 2;  // ARROW_DEVICE_CUDA
+
+                auto imported = import_array_from_device_capsules(schema_capsule, device_array_capsule);
+                CHECK(PyErr_ExceptionMatches(PyExc_ValueError));
+                PyErr_Clear();
+                CHECK_NE(device_array->array.release, nullptr);
+            }
+
+            SUBCASE("stream_round_trip")
+            {
+                std::vector<sparrow::array> arrays;
+                arrays.push_back(make_test_array());
+                arrays.push_back(make_test_array());
+                sparrow::arrow_array_stream_proxy proxy;
+                proxy.push(std::move(arrays));
+
+                PyObjectGuard capsule_guard(export_stream_proxy_to_device_capsule(proxy));
+                REQUIRE_NE(capsule_guard.ptr, nullptr);
+                auto* device_stream = static_cast<ArrowDeviceArrayStream*>(
+                    PyCapsule_GetPointer(capsule_guard.ptr, "arrow_device_array_stream")
+                );
+                REQUIRE_NE(device_stream, nullptr);
+                CHECK_EQ(device_stream->device_type, ARROW_DEVICE_CPU);
+
+                auto imported_proxy = import_stream_proxy_from_device_capsule(capsule_guard.ptr);
+                CHECK_EQ(device_stream->release, nullptr);
+                CHECK_NE(imported_proxy.pop(), std::nullopt);
+                CHECK_NE(imported_proxy.pop(), std::nullopt);
+                CHECK_EQ(imported_proxy.pop(), std::nullopt);
+            }
+        }
+
+        TEST_CASE("lazy_import")
+        {
+            PythonInitializer py_init;
+
+            SUBCASE("keeps_raw_structures_until_materialized")
+            {
+                auto arr = make_test_array();
+                auto [schema_capsule, array_capsule] = export_array_to_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                auto lazy = import_lazy_array_from_capsules(schema_capsule, array_capsule);
+                REQUIRE_NE(lazy, nullptr);
+                CHECK_FALSE(lazy->is_materialized());
+                CHECK_EQ(lazy->arrow_array().length, 5);
+                CHECK_EQ(std::string_view(lazy->arrow_schema().format), "i");
+                const void* data = lazy->arrow_array().buffers[1];
+
+                sparrow::array& materialized = lazy->materialize();
+                CHECK(lazy->is_materialized());
+                CHECK_EQ(materialized.size(), 5);
+                CHECK_EQ(lazy->arrow_array().buffers[1], data);
+            }
+
+            SUBCASE("re_export_shares_buffers")
+            {
+                auto arr = make_test_array();
+                auto [schema_capsule, array_capsule] = export_array_to_capsules(arr);
+                PyObjectGuard schema_guard(schema_capsule);
+                PyObjectGuard array_guard(array_capsule);
+
+                std::shared_ptr<detail::lazy_arrow_array> lazy =
+                    import_lazy_array_from_capsules(schema_capsule, array_capsule);
+                REQUIRE_NE(lazy, nullptr);
+                const auto schema = detail::shared_arrow_schema::make(lazy->arrow_schema());
+                auto [out_schema, out_array] = export_shared_array_to_capsules(lazy->arrow_array(), lazy, *schema);
+                PyObjectGuard out_schema_guard(out_schema);
+                PyObjectGuard out_array_guard(out_array);
+
+                auto* exported = static_cast<ArrowArray*>(PyCapsule_GetPointer(out_array, "arrow_array"));
+                REQUIRE_NE(exported, nullptr);
+                CHECK_EQ(exported->buffers[1], lazy->arrow_array().buffers[1]);
+                CHECK_FALSE(lazy->is_materialized());
+
+                // The export keeps the raw structures alive on its own
+                const void* data = lazy->arrow_array().buffers[1];
+                lazy.reset();
+                auto imported = import_array_from_capsules(out_schema, out_array);
+                CHECK_EQ(imported.size(), 5);
+                CHECK_EQ(sparrow::get_arrow_array(imported)->buffers[1], data);
+            }
+
+            SUBCASE("invalid_capsule_returns_nullptr")
+            {
+                PyObjectGuard not_a_capsule(PyLong_FromLong(1));
+                auto lazy = import_lazy_array_from_capsules(not_a_capsule.ptr, not_a_capsule.ptr);
+                CHECK_EQ(lazy, nullptr);
+                CHECK_NE(PyErr_Occurred(), nullptr);
+                PyErr_Clear();
+            }
+        }
+
         TEST_CASE("round_trip_export_import")
         {
             PythonInitializer py_init;
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""
+Tests for the SparrowRecordBatch Arrow PyCapsule Interface implementation.
+
+This test validates:
+1. SparrowRecordBatch creation from columns and from struct-exporting objects
+2. __arrow_c_array__ export of all the columns as one struct array
+3. Zero-copy column access, including on sliced batches
+"""
+
+import pytest
+import pyarrow as pa
+
+
+# Import the module (try release first, then debug)
+try:
+    import sparrow_rockfinch as sr
+except ImportError:
+    import sparrow_rockfinchd as sr
+
+
+class TestSparrowRecordBatchCreation:
+    """Test SparrowRecordBatch creation and basic properties."""
+
+    def test_from_columns(self):
+        """Columns and names build one batch."""
+        x = sr.SparrowArray.from_arrow(pa.array([1, 2, None], type=pa.int32()))
+        s = sr.SparrowArray.from_arrow(pa.array(["a", None, "c"]))
+        batch = sr.SparrowRecordBatch([x, s], ["x", "s"])
+
+        assert batch.num_rows() == 3
+        assert len(batch) == 3
+        assert batch.num_columns() == 2
+        assert batch.column_names() == ["x", "s"]
+
+    def test_from_columns_rejects_mismatches(self):
+        """Names must match the columns, and columns must have the same length."""
+        x = sr.SparrowArray.from_arrow(pa.array([1, 2, 3]))
+        y = sr.SparrowArray.from_arrow(pa.array([1, 2]))
+
+        with pytest.raises(ValueError):
+            sr.SparrowRecordBatch([x], ["x", "y"])
+        with pytest.raises(ValueError):
+            sr.SparrowRecordBatch([x, y], ["x", "y"])
+
+    def test_from_arrow_record_batch(self):
+        """A pyarrow RecordBatch is imported as a struct array."""
+        pa_batch = pa.record_batch({"x": [1, 2, 3], "y": [1.5, 2.5, None]})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch, lazy=True)
+
+        assert batch.num_rows() == 3
+        assert batch.column_names() == ["x", "y"]
+
+    def test_from_ndarray_columns(self):
+        """The columns of a 2D ndarray become the columns of the batch."""
+        np = pytest.importorskip("numpy")
+        matrix = np.arange(12, dtype=np.float64).reshape(4, 3)
+
+        batch = sr.SparrowRecordBatch.from_ndarray(matrix, names=["a", "b", "c"])
+        result = pa.record_batch(batch)
+
+        assert result.schema.names == ["a", "b", "c"]
+        assert result.column("b").to_pylist() == matrix[:, 1].tolist()
+        assert sr.SparrowRecordBatch.from_ndarray(matrix).column_names() == ["0", "1", "2"]
+
+    def test_from_ndarray_shares_fortran_ordered_columns(self):
+        """Columns of a column-major ndarray are not copied."""
+        np = pytest.importorskip("numpy")
+        matrix = np.asfortranarray(np.arange(12, dtype=np.int32).reshape(4, 3))
+
+        batch = sr.SparrowRecordBatch.from_ndarray(matrix)
+
+        address = pa.record_batch(batch).column(2).buffers()[1].address
+        assert address == matrix[:, 2].__array_interface__["data"][0]
+
+    def test_from_arrow_rejects_non_struct_arrays(self):
+        """Only struct arrays describe record batches."""
+        with pytest.raises(TypeError):
+            sr.SparrowRecordBatch.from_arrow(pa.array([1, 2, 3]))
+
+
+class TestSparrowRecordBatchExport:
+    """Test SparrowRecordBatch __arrow_c_array__ export."""
+
+    def test_export_shares_column_buffers(self):
+        """The exported struct array shares the buffers of the columns."""
+        pa_x = pa.array([1, 2, None], type=pa.int64())
+        pa_s = pa.array(["a", "bc", None])
+        batch = sr.SparrowRecordBatch(
+            [sr.SparrowArray.from_arrow(pa_x), sr.SparrowArray.from_arrow(pa_s)], ["x", "s"]
+        )
+
+        result = pa.record_batch(batch)
+        assert result.schema.names == ["x", "s"]
+        assert result.column("x").to_pylist() == [1, 2, None]
+        assert result.column("s").to_pylist() == ["a", "bc", None]
+        assert result.column("x").buffers()[1].address == pa_x.buffers()[1].address
+        assert result.column("s").buffers()[2].address == pa_s.buffers()[2].address
+
+    def test_roundtrip_through_pyarrow(self):
+        """PyArrow RecordBatch -> SparrowRecordBatch -> PyArrow RecordBatch."""
+        pa_batch = pa.record_batch({"x": [1, None, 3], "s": ["a", "é", None]})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch)
+
+        assert pa.record_batch(batch).equals(pa_batch)
+        assert pa.Schema._import_from_c_capsule(batch.__arrow_c_schema__()) == pa_batch.schema
+
+    def test_requested_schema_casts_columns(self):
+        """A requested struct schema casts the columns that differ."""
+        pa_batch = pa.record_batch({"x": pa.array([1, 2], type=pa.int32()), "s": ["a", "b"]})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch)
+        requested = pa.schema([("x", pa.int64()), ("s", pa.large_string())])
+
+        schema_capsule, array_capsule = batch.__arrow_c_array__(requested.__arrow_c_schema__())
+        result = pa.RecordBatch._import_from_c_capsule(schema_capsule, array_capsule)
+        assert result.schema == requested
+        assert result.column("x").to_pylist() == [1, 2]
+
+
+class TestSparrowRecordBatchColumns:
+    """Test zero-copy column access."""
+
+    def test_column_by_index_and_name(self):
+        """Columns are selected by index, negative index or name."""
+        pa_batch = pa.record_batch({"x": [1, 2, 3], "y": [4, 5, 6]})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch)
+
+        assert pa.array(batch.column(0)).to_pylist() == [1, 2, 3]
+        assert pa.array(batch.column("y")).to_pylist() == [4, 5, 6]
+        assert pa.array(batch[-1]).to_pylist() == [4, 5, 6]
+        with pytest.raises(KeyError):
+            batch.column("z")
+        with pytest.raises(IndexError):
+            batch[2]
+
+    def test_column_is_a_lazy_view(self):
+        """Column access neither copies buffers nor builds the column."""
+        pa_batch = pa.record_batch({"x": pa.array([1.5, 2.5], type=pa.float64())})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch)
+        column = batch.column("x")
+
+        assert not column.is_materialized()
+        assert pa.array(column).buffers()[1].address == pa_batch.column(0).buffers()[1].address
+        del batch
+        assert column.to_numpy().tolist() == [1.5, 2.5]
+
+    def test_columns_of_sliced_batch(self):
+        """Columns of a sliced batch cover the rows of the slice."""
+        pa_batch = pa.record_batch({"x": [1, None, 3, 4, None], "s": ["a", "b", None, "d", "e"]})
+        batch = sr.SparrowRecordBatch.from_arrow(pa_batch.slice(1, 3))
+
+        columns = batch.columns()
+        assert [pa.array(column).to_pylist() for column in columns] == [[None, 3, 4], ["b", None, "d"]]
+        assert pa.array(columns[0]).null_count == 1
@@ -10,6 +10,8 @@ This test validates:
 5. Integration with PyArrow streams
 """
 
+import struct
+
 import pytest
 import pyarrow as pa
 
@@ -186,6 +188,141 @@ class TestSparrowStreamRoundTrip:
         assert result_table.num_rows == original_table.num_rows
 
 
+class TestSparrowStreamRequestedSchema:
+    """Test the requested_schema argument of __arrow_c_stream__."""
+
+    def test_requested_schema_casts_batches(self):
+        """Every batch is exported with the requested schema."""
+        batch1 = pa.record_batch({"x": pa.array([1, 2, None], type=pa.int32()), "s": ["a", "b", None]})
+        batch2 = pa.record_batch({"x": pa.array([4, 5, 6], type=pa.int32()), "s": ["d", None, "f"]})
+        reader = pa.RecordBatchReader.from_batches(batch1.schema, [batch1, batch2])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        requested = pa.schema({"x": pa.int64(), "s": pa.large_string()})
+        capsule = stream.__arrow_c_stream__(requested.__arrow_c_schema__())
+        result = pa.RecordBatchReader._import_from_c_capsule(capsule).read_all()
+
+        assert result.schema.types == [pa.int64(), pa.large_string()]
+        assert result.column("x").to_pylist() == [1, 2, None, 4, 5, 6]
+        assert result.column("s").to_pylist() == ["a", "b", None, "d", None, "f"]
+
+    def test_requested_schema_falls_back_to_native_layout(self):
+        """Batches that cannot be cast are exported with their own schema."""
+        batch = pa.record_batch({"x": pa.array([1.5, 2.5], type=pa.float64())})
+        reader = pa.RecordBatchReader.from_batches(batch.schema, [batch])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        requested = pa.schema({"x": pa.int32()})
+        capsule = stream.__arrow_c_stream__(requested.__arrow_c_schema__())
+        result = pa.RecordBatchReader._import_from_c_capsule(capsule).read_all()
+
+        assert result.schema.types == [pa.float64()]
+        assert result.column("x").to_pylist() == [1.5, 2.5]
+
+    def test_requested_schema_applies_to_empty_streams(self):
+        """A stream without batches reports the requested schema."""
+        reader = pa.RecordBatchReader.from_batches(pa.schema({"x": pa.int32()}), [])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        requested = pa.schema({"x": pa.int64()})
+        capsule = stream.__arrow_c_stream__(requested.__arrow_c_schema__())
+        result = pa.RecordBatchReader._import_from_c_capsule(capsule).read_all()
+
+        assert result.schema.types == [pa.int64()]
+        assert result.num_rows == 0
+
+    def test_requested_schema_casts_batches_as_they_are_read(self):
+        """Batches are cast one at a time: one that does not fit fails when read."""
+        batch1 = pa.record_batch({"x": pa.array([1, 2], type=pa.int32())})
+        batch2 = pa.record_batch({"x": pa.array([1000], type=pa.int32())})
+        reader = pa.RecordBatchReader.from_batches(batch1.schema, [batch1, batch2])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        requested = pa.schema({"x": pa.int8()})
+        capsule = stream.__arrow_c_stream__(requested.__arrow_c_schema__())
+        result = pa.RecordBatchReader._import_from_c_capsule(capsule)
+
+        assert result.schema.types == [pa.int8()]
+        assert result.read_next_batch().column(0).to_pylist() == [1, 2]
+        with pytest.raises(pa.ArrowInvalid, match="cannot be cast"):
+            result.read_next_batch()
+
+
+class TestSparrowStreamDevice:
+    """Test the Arrow C Device Data Interface on SparrowStream."""
+
+    def test_device_stream_round_trip(self):
+        """A device stream export can be imported back as a SparrowStream."""
+        batch1 = pa.record_batch({"x": [1, 2, 3]})
+        batch2 = pa.record_batch({"x": [4, 5]})
+        reader = pa.RecordBatchReader.from_batches(batch1.schema, [batch1, batch2])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        capsule = stream.__arrow_c_device_stream__()
+        assert stream.is_consumed()
+
+        imported = sr.SparrowStream.from_stream(capsule)
+        result = pa.RecordBatchReader.from_stream(imported).read_all()
+        assert result.column("x").to_pylist() == [1, 2, 3, 4, 5]
+
+    @pytest.mark.skipif(
+        not hasattr(pa.RecordBatchReader, "_import_from_c_device_capsule"),
+        reason="requires pyarrow with the Arrow C Device Data Interface",
+    )
+    def test_device_stream_consumed_by_pyarrow(self):
+        """PyArrow reads the CPU device stream."""
+        batch = pa.record_batch({"x": [1, None, 3]})
+        reader = pa.RecordBatchReader.from_batches(batch.schema, [batch])
+        stream = sr.SparrowStream.from_stream(reader)
+
+        result = pa.RecordBatchReader._import_from_c_device_capsule(stream.__arrow_c_device_stream__())
+        assert result.read_all().column("x").to_pylist() == [1, None, 3]
+
+    def test_from_stream_accepts_device_only_producers(self):
+        """Objects exposing only __arrow_c_device_stream__ can be imported."""
+
+        class DeviceOnly:
+            def __init__(self, source):
+                self._source = source
+
+            def __arrow_c_device_stream__(self, requested_schema=None, **kwargs):
+                return self._source.__arrow_c_device_stream__(requested_schema, **kwargs)
+
+        batch = pa.record_batch({"x": [7, 8]})
+        reader = pa.RecordBatchReader.from_batches(batch.schema, [batch])
+        source = sr.SparrowStream.from_stream(reader)
+
+        imported = sr.SparrowStream.from_stream(DeviceOnly(source))
+        result = pa.RecordBatchReader.from_stream(imported).read_all()
+        assert result.column("x").to_pylist() == [7, 8]
+
+
+class TestSparrowStreamValidation:
+    """Test the validate="full" import mode of SparrowStream.from_stream."""
+
+    def test_validate_full_reads_valid_batches(self):
+        """Well-formed batches go through unchanged."""
+        batch = pa.record_batch({"x": [1, None, 3], "s": ["a", "é", None]})
+        reader = pa.RecordBatchReader.from_batches(batch.schema, [batch, batch])
+        stream = sr.SparrowStream.from_stream(reader, validate="full")
+
+        result = pa.RecordBatchReader.from_stream(stream).read_all()
+        assert result.column("x").to_pylist() == [1, None, 3] * 2
+        assert result.column("s").to_pylist() == ["a", "é", None] * 2
+
+    def test_validate_full_rejects_malformed_batch(self):
+        """A batch with invalid UTF-8 makes the read fail."""
+        bad = pa.Array.from_buffers(
+            pa.string(), 2, [None, pa.py_buffer(struct.pack("<3i", 0, 1, 3)), pa.py_buffer(b"a\xff\xfe")]
+        )
+        batch = pa.record_batch({"s": bad})
+        reader = pa.RecordBatchReader.from_batches(batch.schema, [batch])
+        stream = sr.SparrowStream.from_stream(reader, validate="full")
+
+        with pytest.raises((ValueError, RuntimeError)):
+            stream.pop()
+
+
 class TestSparrowStreamWithDifferentTypes:
     """Test SparrowStream with various Arrow data types."""
 
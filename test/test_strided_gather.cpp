@@ -0,0 +1,132 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <sparrow-rockfinch/detail/strided_gather.hpp>
+
+#include "doctest/doctest.h"
+
+namespace sparrow::rockfinch::detail
+{
+    namespace
+    {
+        // Gather `length` elements of `item_size` bytes from `source` with a stride of
+        // `step` elements, starting at element `first`, and check them one by one
+        void check_gather(
+            const std::vector<std::uint8_t>& source,
+            std::size_t item_size,
+            std::size_t first,
+            std::ptrdiff_t step,
+            std::size_t length
+        )
+        {
+            const auto stride = step * static_cast<std::ptrdiff_t>(item_size);
+            const auto* start = reinterpret_cast<const std::byte*>(source.data() + first * item_size);
+            std::vector<std::uint8_t> target(length * item_size + 1, 0x2A);
+            gather_strided(start, stride, item_size, length, reinterpret_cast<std::byte*>(target.data()));
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto element = static_cast<std::ptrdiff_t>(first) + static_cast<std::ptrdiff_t>(i) * step;
+                REQUIRE(std::memcmp(target.data() + i * item_size, source.data() + element * item_size, item_size) == 0);
+            }
+            // Nothing is written past the end
+            REQUIRE(target[length * item_size] == 0x2A);
+        }
+    }
+
+    TEST_SUITE("strided_gather")
+    {
+        TEST_CASE("positive, negative and zero strides")
+        {
+            std::vector<std::uint8_t> source(4096);
+            std::iota(source.begin(), source.end(), std::uint8_t{0});
+            for (const std::size_t item_size : {1, 2, 3, 4, 8, 16})
+            {
+                const std::size_t n_items = source.size() / item_size;
+                check_gather(source, item_size, 0, 2, n_items / 2);
+                check_gather(source, item_size, 1, 3, n_items / 3);
+                check_gather(source, item_size, n_items - 1, -1, n_items);
+                check_gather(source, item_size, n_items - 1, -5, n_items / 5);
+                check_gather(source, item_size, 7, 0, 100);
+                check_gather(source, item_size, 0, 2, 0);
+            }
+        }
+
+        TEST_CASE("byte-swapping gather")
+        {
+            std::vector<std::uint8_t> source(4096);
+            std::iota(source.begin(), source.end(), std::uint8_t{0});
+            for (const std::size_t item_size : {2, 3, 4, 8})
+            {
+                const std::size_t n_items = source.size() / item_size;
+                for (const std::ptrdiff_t step : {1, 2, -1, 0})
+                {
+                    const std::size_t first = step < 0 ? n_items - 1 : 0;
+                    const std::size_t length = step == 2 ? n_items / 2 : n_items;
+                    const auto* start = reinterpret_cast<const std::byte*>(source.data() + first * item_size);
+                    std::vector<std::uint8_t> target(length * item_size + 1, 0x2A);
+                    gather_strided_byteswap(
+                        start,
+                        step * static_cast<std::ptrdiff_t>(item_size),
+                        item_size,
+                        length,
+                        reinterpret_cast<std::byte*>(target.data())
+                    );
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        const auto element = static_cast<std::ptrdiff_t>(first) + static_cast<std::ptrdiff_t>(i) * step;
+                        for (std::size_t b = 0; b < item_size; ++b)
+                        {
+                            REQUIRE(target[i * item_size + b] == source[element * item_size + item_size - 1 - b]);
+                        }
+                    }
+                    REQUIRE(target[length * item_size] == 0x2A);
+                }
+            }
+        }
+
+        TEST_CASE("parallel byte-swapping gather")
+        {
+            const std::size_t length = parallel_gather_min_bytes / sizeof(std::uint32_t) + 13;
+            std::vector<std::uint32_t> source(length);
+            std::iota(source.begin(), source.end(), std::uint32_t{0});
+            std::vector<std::uint32_t> target(length);
+            gather_strided_byteswap(
+                reinterpret_cast<const std::byte*>(source.data()),
+                sizeof(std::uint32_t),
+                sizeof(std::uint32_t),
+                length,
+                reinterpret_cast<std::byte*>(target.data())
+            );
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::uint32_t value = source[i];
+                const std::uint32_t swapped = (value >> 24) | ((value >> 8) & 0xFF00u) | ((value << 8) & 0xFF0000u)
+                                              | (value << 24);
+                REQUIRE(target[i] == swapped);
+            }
+        }
+
+        TEST_CASE("parallel gather")
+        {
+            // Above parallel_gather_min_bytes once gathered, with an uneven split
+            const std::size_t length = parallel_gather_min_bytes / sizeof(std::uint32_t) + 13;
+            std::vector<std::uint32_t> source(2 * length);
+            std::iota(source.begin(), source.end(), std::uint32_t{0});
+            std::vector<std::uint32_t> target(length);
+            gather_strided(
+                reinterpret_cast<const std::byte*>(source.data() + source.size() - 1),
+                -2 * static_cast<std::ptrdiff_t>(sizeof(std::uint32_t)),
+                sizeof(std::uint32_t),
+                length,
+                reinterpret_cast<std::byte*>(target.data())
+            );
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                REQUIRE(target[i] == source.size() - 1 - 2 * i);
+            }
+        }
+    }
+}